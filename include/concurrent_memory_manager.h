@@ -0,0 +1,350 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        concurrent_memory_manager.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __CONCURRENT_MEMORY_MANAGER_H_GUARD
+#define __CONCURRENT_MEMORY_MANAGER_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uintptr_t
+#include <atomic>       // std::atomic, std::atomic_flag
+#include <new>          // std::nothrow
+#include <cassert>      // assert
+#include "memory_pool.h"
+
+
+/// <summary>
+/// A DYNAMIC_MEMORY_MANAGER whose slots may be created, deleted and looked up from many threads at once.
+///
+/// Slot pointers are atomics: GetPool, TryGetPool and PoolExists are a single atomic load, and
+/// CreatePool claims its slot with a compare-exchange before allocating, so racing creators never
+/// allocate a pool they then throw away. DeletePool unlinks the pool immediately but frees it only
+/// once no reader can still hold it, using epoch-based reclamation: readers Pin the manager for the
+/// duration of their lookups and use of the pool, and a retired pool is freed once the global epoch
+/// has advanced twice past its retirement, which requires every pinned reader to have moved on.
+///
+/// The manager protects the slots, not the pools: each pool is still single-threaded, so a pool must
+/// only be used by one thread at a time (e.g. one pool per connection or per worker).
+/// At most MaxReaders threads may hold a pin at the same time; further Pin calls spin until one is released.
+/// SwapPools and the recycle cache of DYNAMIC_MEMORY_MANAGER are not offered here.
+/// Not copyable. Not movable.
+/// </summary>
+/// <typeparam name="Count">The number of pool slots.</typeparam>
+/// <typeparam name="MaxReaders">The number of pins that may be held at once. Defaults to 64.</typeparam>
+/// <typeparam name="SOURCE">The memory source for the pools' blocks. Defaults to HEAP_MEMORY_SOURCE.</typeparam>
+template<size_t Count, size_t MaxReaders = 64, typename SOURCE = HEAP_MEMORY_SOURCE>
+class CONCURRENT_DYNAMIC_MEMORY_MANAGER
+{
+    public:
+        using POOL = SOURCED_MEMORY_POOL<SOURCE>;
+
+    private:
+
+        /// <summary>
+        /// A pool plus the bookkeeping to retire it, allocated together so retiring allocates nothing.
+        /// </summary>
+        struct NODE
+        {
+            POOL Pool;
+            NODE* NextRetired = nullptr;
+            uint64_t RetiredEpoch = 0;
+
+            explicit NODE(size_t poolSize) : Pool(poolSize) { }
+        };
+
+        struct alignas(64) READER_SLOT          // One cache line each, so pins on different threads do not false-share
+        {
+            std::atomic<uint64_t> Epoch{ 0 };   // The epoch the holder pinned, or 0 when free
+        };
+
+        [[nodiscard]] static inline NODE* Claimed() noexcept { return reinterpret_cast<NODE*>(uintptr_t(1)); }   // Marks a slot reserved by a CreatePool in progress
+
+        std::atomic<NODE*> _Slots[Count];
+        std::atomic<size_t> _ActiveCount{ 0 };
+
+        alignas(64) std::atomic<uint64_t> _Epoch{ 1 };
+        std::atomic<NODE*> _Retired{ nullptr };     // Lock-free stack of pools awaiting reclamation
+        std::atomic<size_t> _RetiredCount{ 0 };
+        std::atomic_flag _Reclaiming = ATOMIC_FLAG_INIT;
+        uint64_t _ReclaimedEpoch = 0;               // Epoch of the last full pass; guarded by _Reclaiming
+        READER_SLOT _Readers[MaxReaders];
+
+        static constexpr size_t ReclaimBatch = 32;      // Retirements between automatic Reclaim passes
+
+        [[nodiscard]] static inline bool IsLive(NODE* node) noexcept { return node != nullptr && node != Claimed(); }
+
+        void PushRetired(NODE* first, NODE* last) noexcept
+        {
+            NODE* head = _Retired.load(std::memory_order_relaxed);
+            do
+            {
+                last->NextRetired = head;
+            } while (!_Retired.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /// <summary>
+        /// Advances the global epoch if every pinned reader has observed the current one.
+        /// </summary>
+        bool TryAdvanceEpoch() noexcept
+        {
+            uint64_t epoch = _Epoch.load(std::memory_order_seq_cst);
+
+            for (size_t i = 0; i < MaxReaders; ++i)
+            {
+                const uint64_t pinned = _Readers[i].Epoch.load(std::memory_order_seq_cst);
+                if (pinned != 0 && pinned != epoch)
+                    return false;
+            }
+
+            return _Epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+        }
+
+        void Unpin(size_t reader) noexcept
+        {
+            _Readers[reader].Epoch.store(0, std::memory_order_release);
+        }
+
+    public:
+
+        /// <summary>
+        /// Marks the calling thread as a reader for its lifetime. Pools looked up while a pin is held
+        /// stay allocated until it is released, even if another thread deletes their slot.
+        /// Keep pins short (e.g. one request); a long-held pin delays every pending free.
+        /// </summary>
+        class PIN
+        {
+            private:
+                CONCURRENT_DYNAMIC_MEMORY_MANAGER* _Manager;
+                size_t _Reader;
+
+            public:
+                PIN(CONCURRENT_DYNAMIC_MEMORY_MANAGER* manager, size_t reader) noexcept : _Manager(manager), _Reader(reader) { }
+                ~PIN() { _Manager->Unpin(_Reader); }
+
+                PIN(const PIN&) = delete;
+                PIN& operator=(const PIN&) = delete;
+                PIN(PIN&&) = delete;
+                PIN& operator=(PIN&&) = delete;
+        };
+
+        CONCURRENT_DYNAMIC_MEMORY_MANAGER() noexcept
+        {
+            for (size_t i = 0; i < Count; ++i)
+                _Slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Frees every pool, live or retired. No other thread may be using the manager.
+        /// </summary>
+        ~CONCURRENT_DYNAMIC_MEMORY_MANAGER()
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                NODE* node = _Slots[i].load(std::memory_order_acquire);
+                if (IsLive(node))
+                    delete node;
+            }
+
+            for (NODE* node = _Retired.load(std::memory_order_acquire); node != nullptr; )
+            {
+                NODE* next = node->NextRetired;
+                delete node;
+                node = next;
+            }
+        }
+
+        CONCURRENT_DYNAMIC_MEMORY_MANAGER(const CONCURRENT_DYNAMIC_MEMORY_MANAGER&) = delete;
+        CONCURRENT_DYNAMIC_MEMORY_MANAGER& operator=(const CONCURRENT_DYNAMIC_MEMORY_MANAGER&) = delete;
+        CONCURRENT_DYNAMIC_MEMORY_MANAGER(CONCURRENT_DYNAMIC_MEMORY_MANAGER&&) = delete;
+        CONCURRENT_DYNAMIC_MEMORY_MANAGER& operator=(CONCURRENT_DYNAMIC_MEMORY_MANAGER&&) = delete;
+
+        [[nodiscard]] static constexpr size_t MaxPoolCount() noexcept { return Count; }
+        [[nodiscard]] size_t ActivePoolCount() const noexcept { return _ActiveCount.load(std::memory_order_relaxed); }
+
+        /// <summary>
+        /// Pins the manager for the calling thread, e.g. auto pin = manager.Pin();
+        /// Required around GetPool/TryGetPool and any use of the returned pool.
+        /// </summary>
+        [[nodiscard]] PIN Pin() noexcept
+        {
+            static thread_local size_t hint = reinterpret_cast<uintptr_t>(&hint) / 64;     // Spreads threads across reader slots
+
+            for (size_t attempt = 0; ; ++attempt)
+            {
+                const size_t reader = (hint + attempt) % MaxReaders;
+                uint64_t free = 0;
+                uint64_t epoch = _Epoch.load(std::memory_order_seq_cst);
+
+                if (!_Readers[reader].Epoch.compare_exchange_strong(free, epoch, std::memory_order_seq_cst))
+                    continue;
+
+                uint64_t current;
+                while ((current = _Epoch.load(std::memory_order_seq_cst)) != epoch)    // Re-announce if the epoch moved while claiming
+                {
+                    _Readers[reader].Epoch.store(current, std::memory_order_seq_cst);
+                    epoch = current;
+                }
+
+                hint = reader;
+                return PIN(this, reader);
+            }
+        }
+
+        /// <summary>
+        /// Creates a pool at the specified index. Safe to race with other creators of the same slot;
+        /// exactly one succeeds. Asserts in debug if the index is out of bounds.
+        /// If the pool cannot be allocated, the claim is released and the slot is left free.
+        /// </summary>
+        /// <returns>True if the pool was created; false if the index is out of bounds, the slot is taken or allocation failed.</returns>
+        [[nodiscard]] bool CreatePool(size_t index, size_t poolSize)
+        {
+            assert(index < Count && "CreatePool: Index out of bounds!");
+
+            if (index >= Count)
+                return false;
+
+            NODE* expected = nullptr;
+            if (!_Slots[index].compare_exchange_strong(expected, Claimed(), std::memory_order_acquire, std::memory_order_relaxed))
+                return false;
+
+            NODE* node = new (std::nothrow) NODE(poolSize);
+            if (node == nullptr)
+            {
+                _Slots[index].store(nullptr, std::memory_order_release);        // Leave the slot free, not claimed forever
+                return false;
+            }
+
+            _Slots[index].store(node, std::memory_order_release);
+            _ActiveCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /// <summary>
+        /// Unlinks the pool at the specified index and retires it; it is freed once no pinned reader can
+        /// still be using it. Safe to race with readers and other deleters.
+        /// </summary>
+        /// <returns>True if this call removed a pool; false if the slot was empty or still being created.</returns>
+        bool DeletePool(size_t index) noexcept
+        {
+            assert(index < Count && "Pool index out of bounds!");
+
+            if (index >= Count)
+                return false;
+
+            NODE* node = _Slots[index].load(std::memory_order_acquire);
+            do
+            {
+                if (!IsLive(node))
+                    return false;
+            } while (!_Slots[index].compare_exchange_weak(node, nullptr, std::memory_order_seq_cst, std::memory_order_acquire));
+
+            _ActiveCount.fetch_sub(1, std::memory_order_relaxed);
+
+            node->RetiredEpoch = _Epoch.load(std::memory_order_seq_cst);
+            PushRetired(node, node);
+
+            if (_RetiredCount.fetch_add(1, std::memory_order_relaxed) + 1 >= ReclaimBatch)     // Amortizes the reader scan and list walk
+                Reclaim();
+            return true;
+        }
+
+        /// <summary>
+        /// Tries to advance the epoch and frees every retired pool that no reader can still hold.
+        /// DeletePool calls it every ReclaimBatch retirements; call it directly to flush retirements on a quiet manager.
+        /// Only one thread reclaims at a time; others return immediately.
+        /// </summary>
+        /// <returns>The number of pools freed.</returns>
+        size_t Reclaim() noexcept
+        {
+            if (_Reclaiming.test_and_set(std::memory_order_acquire))
+                return 0;
+
+            TryAdvanceEpoch();
+            const uint64_t epoch = _Epoch.load(std::memory_order_seq_cst);
+
+            if (epoch == _ReclaimedEpoch)                   // Nothing new can have become free while a reader holds the epoch back
+            {
+                _Reclaiming.clear(std::memory_order_release);
+                return 0;
+            }
+            _ReclaimedEpoch = epoch;
+
+            NODE* pending = _Retired.exchange(nullptr, std::memory_order_acquire);
+            NODE* keepFirst = nullptr;
+            NODE* keepLast = nullptr;
+            size_t freed = 0;
+
+            while (pending != nullptr)
+            {
+                NODE* next = pending->NextRetired;
+
+                if (pending->RetiredEpoch + 2 <= epoch)
+                {
+                    delete pending;
+                    ++freed;
+                    _RetiredCount.fetch_sub(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    pending->NextRetired = keepFirst;
+                    keepFirst = pending;
+                    if (keepLast == nullptr)
+                        keepLast = pending;
+                }
+
+                pending = next;
+            }
+
+            if (keepFirst != nullptr)
+                PushRetired(keepFirst, keepLast);
+
+            _Reclaiming.clear(std::memory_order_release);
+            return freed;
+        }
+
+        /// <summary>
+        /// Returns the pool at the specified index, or nullptr if the slot is empty. Wait-free.
+        /// The caller must hold a Pin for as long as it uses the pool.
+        /// </summary>
+        [[nodiscard]] inline POOL* TryGetPool(size_t index) noexcept
+        {
+            assert(index < Count && "Pool index out of bounds!");
+
+            NODE* node = _Slots[index].load(std::memory_order_seq_cst);          // Ordered after the pin's announcement; a plain load on x86
+            return IsLive(node) ? &node->Pool : nullptr;
+        }
+
+        /// <summary>
+        /// Returns a reference to the pool at the specified index. Wait-free.
+        /// Asserts in debug if the slot is empty; use TryGetPool when another thread may delete it.
+        /// The caller must hold a Pin for as long as it uses the pool.
+        /// </summary>
+        [[nodiscard]] inline POOL& GetPool(size_t index) noexcept
+        {
+            POOL* pool = TryGetPool(index);
+            assert(pool != nullptr && "Attempted to access a null pool!");
+            return *pool;
+        }
+
+        /// <summary>
+        /// Checks if a pool exists at the given index. Wait-free; the answer may be stale by the time it is used.
+        /// </summary>
+        [[nodiscard]] inline bool PoolExists(size_t index) const noexcept
+        {
+            return index < Count && IsLive(_Slots[index].load(std::memory_order_acquire));
+        }
+};
+
+#endif
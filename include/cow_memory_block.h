@@ -0,0 +1,277 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        cow_memory_block.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __COW_MEMORY_BLOCK_H_GUARD
+#define __COW_MEMORY_BLOCK_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uintptr_t
+#include <cstring>      // memcpy, memcmp
+#include <cstdio>       // snprintf
+#include <cassert>      // assert
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <sys/mman.h>   // mmap, munmap, memfd_create, shm_open, shm_unlink
+#include <fcntl.h>      // open, O_* flags
+#include <unistd.h>     // close, ftruncate, pread, sysconf, getpid
+
+
+/// <summary>
+/// Tag selecting the clone constructors of COW_MEMORY_BLOCK and COW_MEMORY_POOL.
+/// </summary>
+struct COW_CLONE_TAG { };
+inline constexpr COW_CLONE_TAG CowClone{};
+
+
+/// <summary>
+/// A memory block that can be cloned copy-on-write.
+/// A root block is an anonymous shared memory object (memfd on Linux) mapped MAP_SHARED. A clone
+/// maps the same object MAP_PRIVATE: creating it costs one mmap regardless of size, reads are served
+/// from the root's pages, and the kernel copies a page only when the clone first writes to it.
+/// CommitTo copies just those private pages back into the root; Revert throws them away.
+///
+/// A clone's untouched pages are the root's pages, so writes to the root while a clone is live
+/// show through in the clone. Treat the root as frozen for the clone's lifetime, apart from commits.
+/// Failing to create or map the object is a runtime condition; check IsNullPtr or the bool conversion.
+/// Not copyable or movable; ownership is strict and non-transferable. POSIX only.
+/// </summary>
+class COW_MEMORY_BLOCK
+{
+    private:
+        void* _Head = nullptr;
+        size_t _SizeInBytes = 0;
+        int _FileDescriptor = -1;       // Owned by the root; -1 for clones, whose mapping keeps the object alive
+        bool _Clone = false;
+
+        [[nodiscard]] static size_t PageSize() noexcept
+        {
+            return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        }
+
+        [[nodiscard]] static int CreateObject() noexcept
+        {
+#if defined(__linux__)
+            return ::memfd_create("MemoryCPP-cow", MFD_CLOEXEC);
+#else
+            static unsigned counter = 0;
+            char name[64];
+            std::snprintf(name, sizeof(name), "/MemoryCPP-cow-%d-%u", static_cast<int>(::getpid()), counter++);
+
+            const int fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd >= 0)
+                ::shm_unlink(name);                                 // Anonymous from here on, like a memfd
+            return fd;
+#endif
+        }
+
+        /// <summary>
+        /// Copies each run of pages for which isDirty returns true from this mapping into target.
+        /// </summary>
+        template<typename DIRTY>
+        size_t CopyRuns(unsigned char* target, size_t firstPage, size_t pageCount, size_t pageSize, DIRTY isDirty) const noexcept
+        {
+            const unsigned char* source = static_cast<const unsigned char*>(_Head);
+            size_t copied = 0;
+            size_t runStart = 0;
+            size_t runLength = 0;
+
+            for (size_t i = 0; i < pageCount; ++i)
+            {
+                if (isDirty(i))
+                {
+                    if (runLength == 0)
+                        runStart = firstPage + i;
+                    ++runLength;
+                    continue;
+                }
+
+                if (runLength)
+                {
+                    std::memcpy(target + runStart * pageSize, source + runStart * pageSize, runLength * pageSize);
+                    copied += runLength;
+                    runLength = 0;
+                }
+            }
+
+            if (runLength)
+            {
+                std::memcpy(target + runStart * pageSize, source + runStart * pageSize, runLength * pageSize);
+                copied += runLength;
+            }
+
+            return copied;
+        }
+
+    public:
+
+        /// <summary>
+        /// Creates a root block backed by a new anonymous shared memory object.
+        /// </summary>
+        /// <param name="sizeInBytes">The size of the block in bytes.</param>
+        explicit COW_MEMORY_BLOCK(size_t sizeInBytes)
+        {
+            _FileDescriptor = CreateObject();
+            if (_FileDescriptor < 0)
+                return;
+
+            if (::ftruncate(_FileDescriptor, static_cast<off_t>(sizeInBytes)) != 0)
+                return;
+
+            void* mapping = ::mmap(nullptr, sizeInBytes, PROT_READ | PROT_WRITE, MAP_SHARED, _FileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+                return;
+
+            _Head = mapping;
+            _SizeInBytes = sizeInBytes;
+        }
+
+        /// <summary>
+        /// Creates a copy-on-write clone of a root block. Only roots can be cloned.
+        /// </summary>
+        /// <param name="root">The root block to clone.</param>
+        COW_MEMORY_BLOCK(const COW_MEMORY_BLOCK& root, COW_CLONE_TAG)
+        {
+            assert(!root._Clone && "COW_MEMORY_BLOCK: cannot clone a clone!");
+
+            if (root._Clone || root._Head == nullptr)
+                return;
+
+            void* mapping = ::mmap(nullptr, root._SizeInBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_NORESERVE, root._FileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+                return;
+
+            _Head = mapping;
+            _SizeInBytes = root._SizeInBytes;
+            _Clone = true;
+        }
+
+        ~COW_MEMORY_BLOCK()
+        {
+            if (_Head)
+                ::munmap(_Head, _SizeInBytes);
+
+            if (_FileDescriptor >= 0)
+                ::close(_FileDescriptor);
+        }
+
+        COW_MEMORY_BLOCK(const COW_MEMORY_BLOCK&) = delete;
+        COW_MEMORY_BLOCK& operator=(const COW_MEMORY_BLOCK&) = delete;
+        COW_MEMORY_BLOCK(COW_MEMORY_BLOCK&&) = delete;
+        COW_MEMORY_BLOCK& operator=(COW_MEMORY_BLOCK&&) = delete;
+
+        [[nodiscard]] inline void* GetHead() const noexcept { return _Head; }
+        [[nodiscard]] inline size_t GetSize() const noexcept { return _SizeInBytes; }
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Head == nullptr; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+        [[nodiscard]] inline bool IsClone() const noexcept { return _Clone; }
+
+        /// <summary>
+        /// Copies every page this clone has written within [0, rangeBytes) into root.
+        /// On Linux the written pages are found from /proc/self/pagemap: a page the clone has copied
+        /// is anonymous, while an untouched or read-only page still belongs to the shared object.
+        /// Where pagemap is unavailable, each page in the range is compared with the root instead.
+        /// </summary>
+        /// <param name="root">The root block this clone was created from.</param>
+        /// <param name="rangeBytes">The number of leading bytes that may have been written.</param>
+        /// <returns>The number of pages copied.</returns>
+        size_t CommitTo(COW_MEMORY_BLOCK& root, size_t rangeBytes) noexcept
+        {
+            assert(_Clone && root._SizeInBytes == _SizeInBytes && "CommitTo: block is not a clone of root!");
+
+            if (!_Clone || _Head == nullptr || root._Head == nullptr)
+                return 0;
+
+            const size_t pageSize = PageSize();
+            const size_t rangeEnd = rangeBytes < _SizeInBytes ? rangeBytes : _SizeInBytes;
+            const size_t pageCount = (rangeEnd + pageSize - 1) / pageSize;       // Mappings are whole pages, so the tail page is safe to copy
+            unsigned char* target = static_cast<unsigned char*>(root._Head);
+            size_t copied = 0;
+
+#if defined(__linux__)
+            const int pagemap = ::open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+            if (pagemap >= 0)
+            {
+                constexpr size_t BatchPages = 512;
+                constexpr uint64_t Present = uint64_t(1) << 63;
+                constexpr uint64_t Swapped = uint64_t(1) << 62;
+                constexpr uint64_t FilePage = uint64_t(1) << 61;
+
+                uint64_t entries[BatchPages];
+                const size_t firstEntry = reinterpret_cast<uintptr_t>(_Head) / pageSize;
+                bool ok = true;
+
+                for (size_t page = 0; ok && page < pageCount; page += BatchPages)
+                {
+                    const size_t batch = pageCount - page < BatchPages ? pageCount - page : BatchPages;
+                    const ssize_t got = ::pread(pagemap, entries, batch * sizeof(uint64_t), static_cast<off_t>((firstEntry + page) * sizeof(uint64_t)));
+
+                    if (got != static_cast<ssize_t>(batch * sizeof(uint64_t)))
+                    {
+                        ok = false;
+                        break;
+                    }
+
+                    copied += CopyRuns(target, page, batch, pageSize, [&](size_t i) noexcept
+                    {
+                        return (entries[i] & (Present | Swapped)) != 0 && (entries[i] & FilePage) == 0;
+                    });
+                }
+
+                ::close(pagemap);
+
+                if (ok)
+                    return copied;
+            }                                                               // On a failed read, pages already copied compare equal below
+#endif
+
+            const unsigned char* source = static_cast<const unsigned char*>(_Head);
+
+            return copied + CopyRuns(target, 0, pageCount, pageSize, [&](size_t i) noexcept
+            {
+                return std::memcmp(source + i * pageSize, target + i * pageSize, pageSize) != 0;
+            });
+        }
+
+        /// <summary>
+        /// Discards every page this clone has written, so it once again reads the root's current contents.
+        /// Remaps the range in place; the head address does not change.
+        /// </summary>
+        /// <param name="root">The root block this clone was created from.</param>
+        /// <returns>True on success; false if the remap failed, in which case the clone is left unmapped.</returns>
+        bool Revert(const COW_MEMORY_BLOCK& root) noexcept
+        {
+            assert(_Clone && root._SizeInBytes == _SizeInBytes && "Revert: block is not a clone of root!");
+
+            if (!_Clone || _Head == nullptr || root._FileDescriptor < 0)
+                return false;
+
+            void* mapping = ::mmap(_Head, _SizeInBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_NORESERVE | MAP_FIXED, root._FileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ::munmap(_Head, _SizeInBytes);
+                _Head = nullptr;
+                _SizeInBytes = 0;
+                return false;
+            }
+
+            return true;
+        }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,147 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        cow_memory_pool.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __COW_MEMORY_POOL_H_GUARD
+#define __COW_MEMORY_POOL_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cassert>      // assert
+#include "memory_pool.h"
+#include "cow_memory_block.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+
+/// <summary>
+/// A MEMORY_POOL that can be forked copy-on-write for speculative work.
+/// Constructing a clone from a root pool costs a single mmap however large the arena is; the clone
+/// starts with the root's contents and allocation position, and only the pages it writes are copied.
+/// When the speculation is done, Commit copies the clone's written pages and allocation position back
+/// into the root, while Discard (or simply destroying the clone) drops them.
+///
+/// The root must not be modified while a clone is live, except through that clone's Commit; its
+/// untouched pages are shared with the clone and changes would show through. Several clones of one
+/// root may coexist, but committing one makes its changes visible in the others' untouched pages.
+/// Clones cannot themselves be cloned.
+/// Not copyable. Not thread-safe. POSIX only.
+/// </summary>
+class COW_MEMORY_POOL : public BASIC_MEMORY_POOL<COW_MEMORY_BLOCK>
+{
+    private:
+        COW_MEMORY_POOL* _Root = nullptr;       // The pool this clone was forked from; nullptr for a root
+
+        [[nodiscard]] inline size_t HighWaterMark() const noexcept
+        {
+            return _NextOffset > _MaxBytesUsed ? _NextOffset : _MaxBytesUsed;
+        }
+
+    public:
+
+        /// <summary>
+        /// Creates a root pool backed by an anonymous shared memory object.
+        /// </summary>
+        /// <param name="sizeInBytes">The size of the arena in bytes.</param>
+        explicit COW_MEMORY_POOL(size_t sizeInBytes)
+            : BASIC_MEMORY_POOL<COW_MEMORY_BLOCK>(sizeInBytes)
+        {
+        }
+
+        /// <summary>
+        /// Forks a copy-on-write clone of a root pool, e.g. COW_MEMORY_POOL clone(root, CowClone).
+        /// The clone must be destroyed before the root.
+        /// </summary>
+        /// <param name="root">The root pool to clone.</param>
+        COW_MEMORY_POOL(COW_MEMORY_POOL& root, COW_CLONE_TAG tag)
+            : BASIC_MEMORY_POOL<COW_MEMORY_BLOCK>(root._Block, tag)
+        {
+            if (_Block.IsNullPtr())
+                return;
+
+            _Root = &root;
+            _NextOffset = root._NextOffset;
+            _MaxBytesUsed = root._MaxBytesUsed;
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            _LastCanary = root._LastCanary;                                     // The records live at the same offsets in the clone
+#endif
+            UnpoisonRange(0, _NextOffset);                                      // The root's slices are live in the clone's mapping too
+        }
+
+        ~COW_MEMORY_POOL() = default;
+
+        COW_MEMORY_POOL(const COW_MEMORY_POOL&) = delete;
+        COW_MEMORY_POOL& operator=(const COW_MEMORY_POOL&) = delete;
+
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Block.IsNullPtr(); }
+        [[nodiscard]] explicit operator bool() const noexcept { return !_Block.IsNullPtr(); }
+        [[nodiscard]] inline bool IsClone() const noexcept { return _Root != nullptr; }
+
+        /// <summary>
+        /// Publishes this clone's changes to its root: copies every page the clone wrote and adopts the
+        /// clone's allocation position. The clone's private pages are then released and it carries on
+        /// reading the root, ready for the next speculation.
+        /// Pointers into the clone's arena become pointers into the root at the same offset.
+        /// </summary>
+        /// <returns>The number of pages copied into the root.</returns>
+        size_t Commit() noexcept
+        {
+            assert(_Root != nullptr && "Commit: only a clone can be committed!");
+
+            if (_Root == nullptr || _Block.IsNullPtr())
+                return 0;
+
+            UnpoisonRange(0, MappedSize());                                     // Pages are copied whole, padding, tail and all
+            _Root->UnpoisonRange(0, MappedSize());
+
+            const size_t pages = _Block.CommitTo(_Root->_Block, HighWaterMark());
+
+            _Root->_NextOffset = _NextOffset;
+            _Root->_MaxBytesUsed = HighWaterMark();
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            _Root->_LastCanary = _LastCanary;
+#endif
+
+            _Block.Revert(_Root->_Block);
+            PoisonRange(_NextOffset, MappedSize());                             // Both sides are unallocated past the new position again
+            _Root->PoisonRange(_NextOffset, MappedSize());
+            return pages;
+        }
+
+        /// <summary>
+        /// Throws away everything this clone has written and returns it to the root's current contents
+        /// and allocation position, without a new mmap of a fresh clone.
+        /// </summary>
+        void Discard() noexcept
+        {
+            assert(_Root != nullptr && "Discard: only a clone can be discarded!");
+
+            if (_Root == nullptr || _Block.IsNullPtr())
+                return;
+
+            const size_t highWater = HighWaterMark();
+            UnpoisonRange(0, highWater);
+            _Block.Revert(_Root->_Block);
+            _NextOffset = _Root->_NextOffset;
+            _MaxBytesUsed = _Root->_MaxBytesUsed;
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            _LastCanary = _Root->_LastCanary;
+#endif
+            PoisonRange(_NextOffset, highWater);
+        }
+};
+
+#endif
+
+#endif
@@ -17,23 +17,188 @@
 #define __DYNAMIC_MEMORY_MANAGER_H_GUARD
 
 #include <assert.h>
+#include <cstdint>      // uint32_t, uint64_t
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // _BitScanForward64
+#endif
 #include "memory_pool.h"
 
+
+/// <summary>
+/// Identifies one particular pool in a DYNAMIC_MEMORY_MANAGER: a slot index plus the slot's
+/// generation when the handle was taken. Deleting or swapping the slot's pool advances the
+/// generation, so a handle held across those operations is detected as stale instead of silently
+/// reaching whatever pool now occupies the slot. A default-constructed handle is never valid.
+/// </summary>
+struct POOL_HANDLE
+{
+    uint32_t Index = 0;
+    uint32_t Generation = 0;        // 0 is never issued
+
+    [[nodiscard]] bool operator==(const POOL_HANDLE& other) const noexcept { return Index == other.Index && Generation == other.Generation; }
+    [[nodiscard]] bool operator!=(const POOL_HANDLE& other) const noexcept { return !(*this == other); }
+};
+
 /// <summary>
 /// A dynamic memory pool manager that owns a fixed number of pool slots, determined at compile time,
 /// but allows pools to be created and destroyed at runtime as needed.
 /// Unlike FIXED_MEMORY_MANAGER, pools are created and deleted independently, making
 /// this suitable for systems where pool sizes or lifetimes are not known upfront.
 /// Pool slots that have not been created are null and will assert in debug if accessed.
+/// Each pool's block comes from SOURCE (see memory_source.h), the heap by default; the pool objects
+/// themselves are always allocated with new.
+/// With a recycle budget set (SetRecycleBudget), DeletePool parks pools in a cache bucketed by
+/// log2 of their size instead of freeing them, and CreatePool reuses a parked pool of at least the
+/// requested size (and less than twice it) before allocating, so churning large pools keeps their
+/// pages warm instead of paying for fresh mappings and page faults every time.
 /// Not copyable. Not movable. Not thread-safe.
 /// </summary>
-template<size_t Count>
+/// <typeparam name="Count">The number of pool slots.</typeparam>
+/// <typeparam name="SOURCE">The memory source for the pools' blocks. Defaults to HEAP_MEMORY_SOURCE.</typeparam>
+template<size_t Count, typename SOURCE = HEAP_MEMORY_SOURCE>
 class DYNAMIC_MEMORY_MANAGER
 {
+    public:
+        using POOL = SOURCED_MEMORY_POOL<SOURCE>;
+
     private:
 
-        MEMORY_POOL* _Pools[Count];      // Fixed array of Pool objects. Lives inside the Manager's memory footprint.
+        static constexpr size_t RecycleBucketCount = sizeof(size_t) * 8;
+
+        static constexpr size_t OccupancyWords = (Count + 63) / 64;
+
+        POOL* _Pools[Count];      // Fixed array of Pool objects. Lives inside the Manager's memory footprint.
         size_t _ActiveCount = 0;
+        size_t _ActiveBytes = 0;                        // Sum of the active pools' sizes
+        uint64_t _Occupied[OccupancyWords] = {};        // Bit i is set while slot i holds a pool
+        size_t _FreeWordHint = 0;                       // No word below this has a free slot
+        uint32_t _Generations[Count];                   // Advanced whenever a slot's occupant changes; handles must match
+
+        POOL* _RecycleBuckets[RecycleBucketCount] = {};     // Parked pools by floor(log2(size)); each links to the next through its first slice
+        size_t _RecycleBudget = 0;                          // Bytes of parked pools allowed; 0 disables recycling
+        size_t _RecycledBytes = 0;
+        size_t _RecycledCount = 0;
+
+        [[nodiscard]] static inline size_t CountTrailingZeros(uint64_t value) noexcept
+        {
+#if defined(_MSC_VER)
+            unsigned long bit;
+            _BitScanForward64(&bit, value);
+            return bit;
+#else
+            return static_cast<size_t>(__builtin_ctzll(value));
+#endif
+        }
+
+        inline void MarkOccupied(size_t index) noexcept { _Occupied[index / 64] |= uint64_t(1) << (index % 64); }
+
+        inline void MarkFree(size_t index) noexcept
+        {
+            _Occupied[index / 64] &= ~(uint64_t(1) << (index % 64));
+            if (index / 64 < _FreeWordHint)
+                _FreeWordHint = index / 64;
+        }
+
+        /// <summary>
+        /// Returns the lowest empty slot, or Count if every slot is taken.
+        /// Skips full words 64 slots at a time, starting from the lowest word known to have room.
+        /// </summary>
+        [[nodiscard]] size_t FindFreeSlot() noexcept
+        {
+            for (size_t word = _FreeWordHint; word < OccupancyWords; ++word)
+            {
+                uint64_t free = ~_Occupied[word];
+                if (word == OccupancyWords - 1 && Count % 64 != 0)
+                    free &= (uint64_t(1) << (Count % 64)) - 1;              // Bits past the last slot are not slots
+
+                if (free != 0)
+                {
+                    _FreeWordHint = word;
+                    return word * 64 + CountTrailingZeros(free);
+                }
+            }
+
+            _FreeWordHint = OccupancyWords;
+            return Count;
+        }
+
+        inline void AdvanceGeneration(size_t index) noexcept
+        {
+            if (++_Generations[index] == 0)     // Skip 0 on wrap so default handles stay invalid
+                _Generations[index] = 1;
+        }
+
+        [[nodiscard]] static inline size_t RecycleBucketOf(size_t sizeInBytes) noexcept
+        {
+            size_t bucket = 0;
+            while (sizeInBytes >>= 1)
+                ++bucket;
+            return bucket;
+        }
+
+        [[nodiscard]] static inline POOL*& RecycleLink(POOL* pool) noexcept
+        {
+            return *static_cast<POOL**>(pool->GetBase());      // A parked pool's only slice, at its head
+        }
+
+        /// <summary>
+        /// Parks a deleted pool in the recycle cache if the budget allows.
+        /// </summary>
+        /// <returns>True if the pool was parked; false if the caller should delete it.</returns>
+        bool Park(POOL* pool) noexcept
+        {
+            const size_t size = pool->Size();
+            if (_RecycledBytes + size > _RecycleBudget)
+                return false;
+
+            pool->Reset();
+            if (pool->TakeSlice(sizeof(POOL*)).IsNullPtr())            // Pools too small to hold the link are not worth parking
+                return false;
+
+            POOL*& bucket = _RecycleBuckets[RecycleBucketOf(size)];
+            RecycleLink(pool) = bucket;
+            bucket = pool;
+
+            _RecycledBytes += size;
+            ++_RecycledCount;
+            return true;
+        }
+
+        /// <summary>
+        /// Returns the link to a parked pool of at least sizeInBytes, and under twice that, or nullptr if none fits.
+        /// </summary>
+        [[nodiscard]] POOL** FindParked(size_t sizeInBytes) const noexcept
+        {
+            POOL** link = const_cast<POOL**>(&_RecycleBuckets[RecycleBucketOf(sizeInBytes)]);
+            for (; *link != nullptr; link = &RecycleLink(*link))
+            {
+                if ((*link)->Size() >= sizeInBytes)
+                    return link;
+            }
+            return nullptr;
+        }
+
+        /// <summary>
+        /// Removes a parked pool of at least sizeInBytes, and under twice that, from the cache.
+        /// </summary>
+        /// <returns>The pool, reset and with its statistics cleared; or nullptr if none fits.</returns>
+        POOL* Unpark(size_t sizeInBytes) noexcept
+        {
+            POOL** link = FindParked(sizeInBytes);
+            if (link == nullptr)
+                return nullptr;
+
+            POOL* pool = *link;
+            *link = RecycleLink(pool);
+            _RecycledBytes -= pool->Size();
+            --_RecycledCount;
+
+            pool->Reset();
+            pool->ResetMaxBytesUsed();
+            pool->ResetStats();
+            return pool;
+        }
 
     public:
 
@@ -42,6 +207,7 @@ class DYNAMIC_MEMORY_MANAGER
         {
             for (size_t i = 0; i < Count; ++i) {
                 _Pools[i] = nullptr;
+                _Generations[i] = 1;
             }
         }
 
@@ -52,6 +218,7 @@ class DYNAMIC_MEMORY_MANAGER
                     delete _Pools[i];
                 }
             }
+            TrimRecycled(0);
         }
 
         DYNAMIC_MEMORY_MANAGER(const DYNAMIC_MEMORY_MANAGER&) = delete;
@@ -76,7 +243,13 @@ class DYNAMIC_MEMORY_MANAGER
         [[nodiscard]] size_t ActivePoolCount() const noexcept { return _ActiveCount; }
 
         /// <summary>
-        /// Allocates a new MEMORY_POOL on the heap at the specified index.
+        /// Returns the total size of the active pools' blocks, excluding pools parked for recycling.
+        /// </summary>
+        [[nodiscard]] size_t ActivePoolBytes() const noexcept { return _ActiveBytes; }
+
+        /// <summary>
+        /// Allocates a new pool on the heap at the specified index.
+        /// With recycling enabled, a parked pool of at least poolSize (and under twice it) is reused instead.
         /// Will not overwrite an existing pool; call DeletePool first if replacement is intended.
         /// In debug builds, this is treated as a hard error and will assert immediately, as calling
         /// CreatePool on an occupied slot or out of bounds index is a programming mistake that should
@@ -98,13 +271,33 @@ class DYNAMIC_MEMORY_MANAGER
             if (index >= Count || _Pools[index] != nullptr)
                 return false;
 
-            _Pools[index] = new MEMORY_POOL(poolSize);
+            POOL* recycled = Unpark(poolSize);
+            _Pools[index] = recycled != nullptr ? recycled : new POOL(poolSize);
             ++_ActiveCount;
+            _ActiveBytes += _Pools[index]->Size();
+            MarkOccupied(index);
             return true;
         }
 
+        /// <summary>
+        /// Creates a pool in the lowest empty slot, for callers that do not care which index they get,
+        /// such as a per-connection registry. Amortized O(1): full runs of 64 slots are skipped with one compare.
+        /// </summary>
+        /// <param name="poolSize">The size in bytes of the new pool.</param>
+        /// <returns>A handle to the new pool, whose Index is the slot chosen; an invalid handle if every slot is taken.</returns>
+        [[nodiscard]] POOL_HANDLE CreatePoolAnySlot(size_t poolSize)
+        {
+            const size_t index = FindFreeSlot();
+            if (index >= Count)
+                return POOL_HANDLE();
+
+            (void)CreatePool(index, poolSize);
+            return GetHandle(index);
+        }
+
         /// <summary>
         /// Explicitly deletes the pool at the specified index and nulls the pointer.
+        /// The pool is parked in the recycle cache instead when the recycle budget has room for it.
         /// Asserts in debug if the index is out of bounds.
         /// Calling this on an uninitialized slot is a safe no-op at runtime.
         /// </summary>
@@ -112,9 +305,13 @@ class DYNAMIC_MEMORY_MANAGER
         {
             assert(index < Count && "Pool index out of bounds!");
             if (_Pools[index] != nullptr) {
-                delete _Pools[index];
+                _ActiveBytes -= _Pools[index]->Size();
+                if (!Park(_Pools[index]))
+                    delete _Pools[index];
                 _Pools[index] = nullptr;
                 --_ActiveCount;
+                AdvanceGeneration(index);
+                MarkFree(index);
             }
         }
 
@@ -122,7 +319,7 @@ class DYNAMIC_MEMORY_MANAGER
         /// Returns a reference to the pool. 
         /// Note: Caller must ensure the pool exists (is not nullptr).
         /// </summary>
-        [[nodiscard]] inline MEMORY_POOL& GetPool(size_t index) noexcept
+        [[nodiscard]] inline POOL& GetPool(size_t index) noexcept
         {
             assert(index < Count && "Pool index out of bounds!");
             assert(_Pools[index] != nullptr && "Attempted to access a null pool!");
@@ -137,7 +334,89 @@ class DYNAMIC_MEMORY_MANAGER
             return (index < Count) && (_Pools[index] != nullptr);
         }
 
+        /// <summary>
+        /// Returns a handle to the pool currently at the specified index, for callers that hold on to
+        /// a pool across code that may delete, recreate or swap it.
+        /// Asserts in debug if the slot is null or out of bounds.
+        /// </summary>
+        [[nodiscard]] inline POOL_HANDLE GetHandle(size_t index) const noexcept
+        {
+            assert(index < Count && "GetHandle: Index out of bounds!");
+            assert(_Pools[index] != nullptr && "GetHandle: Cannot take a handle to a null pool!");
+
+            if (index >= Count || _Pools[index] == nullptr)
+                return POOL_HANDLE();
+
+            return POOL_HANDLE{ static_cast<uint32_t>(index), _Generations[index] };
+        }
 
+        /// <summary>
+        /// Checks whether a handle still refers to the pool it was taken from.
+        /// </summary>
+        [[nodiscard]] inline bool IsValid(POOL_HANDLE handle) const noexcept
+        {
+            return handle.Index < Count && _Generations[handle.Index] == handle.Generation && _Pools[handle.Index] != nullptr;
+        }
+
+        /// <summary>
+        /// Returns the pool a handle refers to, or nullptr if the handle is stale or was never valid.
+        /// </summary>
+        [[nodiscard]] inline POOL* TryGetPool(POOL_HANDLE handle) noexcept
+        {
+            return IsValid(handle) ? _Pools[handle.Index] : nullptr;
+        }
+
+        /// <summary>
+        /// Returns a reference to the pool a handle refers to.
+        /// Asserts in debug if the handle is stale; use TryGetPool where that is expected.
+        /// </summary>
+        [[nodiscard]] inline POOL& GetPool(POOL_HANDLE handle) noexcept
+        {
+            assert(IsValid(handle) && "GetPool: Stale pool handle, the slot was deleted or swapped since it was taken!");
+            return *_Pools[handle.Index];
+        }
+
+
+
+        /// <summary>
+        /// Sets how many bytes of deleted pools may be kept for reuse by CreatePool, trimming the cache
+        /// if it already holds more. 0, the default, disables recycling.
+        /// </summary>
+        /// <param name="budgetInBytes">The maximum total size of parked pools.</param>
+        void SetRecycleBudget(size_t budgetInBytes) noexcept
+        {
+            _RecycleBudget = budgetInBytes;
+            TrimRecycled(budgetInBytes);
+        }
+
+        [[nodiscard]] size_t GetRecycleBudget() const noexcept { return _RecycleBudget; }
+        [[nodiscard]] size_t GetRecycledBytes() const noexcept { return _RecycledBytes; }
+        [[nodiscard]] size_t GetRecycledCount() const noexcept { return _RecycledCount; }
+
+        /// <summary>
+        /// Checks whether CreatePool(index, poolSize) would reuse a parked pool rather than allocate.
+        /// </summary>
+        [[nodiscard]] bool CanRecycle(size_t poolSize) const noexcept { return FindParked(poolSize) != nullptr; }
+
+        /// <summary>
+        /// Frees parked pools, largest buckets first, until at most maxBytes remain cached.
+        /// Call with 0 to release the whole cache, e.g. after a level load or under memory pressure.
+        /// </summary>
+        /// <param name="maxBytes">The number of cached bytes to keep at most.</param>
+        void TrimRecycled(size_t maxBytes) noexcept
+        {
+            for (size_t bucket = RecycleBucketCount; bucket-- > 0 && _RecycledBytes > maxBytes; )
+            {
+                while (_RecycleBuckets[bucket] != nullptr && _RecycledBytes > maxBytes)
+                {
+                    POOL* pool = _RecycleBuckets[bucket];
+                    _RecycleBuckets[bucket] = RecycleLink(pool);
+                    _RecycledBytes -= pool->Size();
+                    --_RecycledCount;
+                    delete pool;
+                }
+            }
+        }
 
         /// <summary>
         /// Resets the pool at the specified index.
@@ -158,10 +437,24 @@ class DYNAMIC_MEMORY_MANAGER
         /// </summary>
         void ResetAll() noexcept
         {
-            for (size_t i = 0; i < Count; ++i)
+            ForEachPool([](size_t, POOL& pool) { pool.Reset(); });
+        }
+
+        /// <summary>
+        /// Calls func(index, pool) for every active pool in index order, skipping empty slots 64 at a time.
+        /// func must not create or delete pools.
+        /// </summary>
+        /// <param name="func">A callable taking (size_t index, POOL& pool).</param>
+        template<typename FUNC>
+        void ForEachPool(FUNC&& func)
+        {
+            for (size_t word = 0; word < OccupancyWords; ++word)
             {
-                if (_Pools[i] != nullptr)
-                    _Pools[i]->Reset();
+                for (uint64_t bits = _Occupied[word]; bits != 0; bits &= bits - 1)
+                {
+                    const size_t index = word * 64 + CountTrailingZeros(bits);
+                    func(index, *_Pools[index]);
+                }
             }
         }
 
@@ -169,6 +462,7 @@ class DYNAMIC_MEMORY_MANAGER
         /// Swaps the pools at the two specified indices.
         /// Not thread-safe; no other thread should be accessing either pool during this operation.
         /// Asserts in debug if either index is out of bounds.
+        /// Handles taken to either slot become stale.
         /// </summary>
         /// <param name="indexA">The index of the first pool.</param>
         /// <param name="indexB">The index of the second pool.</param>
@@ -177,9 +471,17 @@ class DYNAMIC_MEMORY_MANAGER
             assert(indexA < Count && "SwapPools: indexA out of bounds!");
             assert(indexB < Count && "SwapPools: indexB out of bounds!");
 
-            MEMORY_POOL* temp = _Pools[indexA];
+            POOL* temp = _Pools[indexA];
             _Pools[indexA] = _Pools[indexB];
             _Pools[indexB] = temp;
+
+            const bool occupiedA = _Pools[indexA] != nullptr;
+            const bool occupiedB = _Pools[indexB] != nullptr;
+            occupiedA ? MarkOccupied(indexA) : MarkFree(indexA);
+            occupiedB ? MarkOccupied(indexB) : MarkFree(indexB);
+
+            AdvanceGeneration(indexA);
+            AdvanceGeneration(indexB);
         }
 };
 
@@ -26,13 +26,19 @@
 /// All pools are allocated upfront and live inside the manager's own memory footprint  no heap allocation occurs.
 /// Provides compile-time indexed access for zero-cost bounds checking and runtime access for flexibility.
 /// Unlike DYNAMIC_MEMORY_MANAGER, pools cannot be created or destroyed independently; all slots are always alive.
+/// Each pool's block comes from SOURCE (see memory_source.h), the heap by default.
 /// Not copyable. Not movable. Not thread-safe.
 /// </summary>
-template<size_t Count>
+/// <typeparam name="Count">The number of pools.</typeparam>
+/// <typeparam name="SOURCE">The memory source for the pools' blocks. Defaults to HEAP_MEMORY_SOURCE.</typeparam>
+template<size_t Count, typename SOURCE = HEAP_MEMORY_SOURCE>
 class FIXED_MEMORY_MANAGER
 {
+    public:
+        using POOL = SOURCED_MEMORY_POOL<SOURCE>;
+
     private:
-        MEMORY_POOL _StaticPools[Count];      // Fixed array of Pool objects. Lives inside the Manager's memory footprint.
+        POOL _StaticPools[Count];      // Fixed array of Pool objects. Lives inside the Manager's memory footprint.
 
     public:
     
@@ -43,7 +49,7 @@ class FIXED_MEMORY_MANAGER
         /// <typeparam name="Args">Variadic size arguments, one per pool.</typeparam>
         /// <param name="sizes">The size in bytes for each pool, in order.</param>
         template<typename... Args>
-        FIXED_MEMORY_MANAGER(Args... sizes) : _StaticPools{ MEMORY_POOL(sizes)... }
+        FIXED_MEMORY_MANAGER(Args... sizes) : _StaticPools{ POOL(sizes)... }
         {
             static_assert(sizeof...(Args) == Count, "Number of sizes must match Pool Count!");      // This syntax initializes the _Pools array by expanding the "sizes" pack into the array initializer list.
         }
@@ -81,7 +87,7 @@ class FIXED_MEMORY_MANAGER
         /// <returns>A reference to the pool at the given index.</returns>
 
         template<size_t Index>
-        [[nodiscard]] inline MEMORY_POOL& GetPool() noexcept
+        [[nodiscard]] inline POOL& GetPool() noexcept
         {
             static_assert(Index < Count, "Pool index out of bounds!");
             return _StaticPools[Index];
@@ -93,7 +99,7 @@ class FIXED_MEMORY_MANAGER
         /// </summary>
         /// <param name="index">The index of the pool to retrieve.</param>
         /// <returns>A reference to the pool at the given index.</returns>
-        [[nodiscard]] inline MEMORY_POOL& GetPool(size_t index) noexcept
+        [[nodiscard]] inline POOL& GetPool(size_t index) noexcept
         {
             assert(index < Count && "Pool index out of bounds!");
             return _StaticPools[index];
@@ -0,0 +1,56 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        inline_memory_block.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __INLINE_MEMORY_BLOCK_H_GUARD
+#define __INLINE_MEMORY_BLOCK_H_GUARD
+
+#include <cstddef>      // size_t
+
+
+/// <summary>
+/// A block whose storage is a member array rather than an allocation, so it lives wherever its
+/// owner does: on the stack, inside another object or in static storage. Construction and
+/// destruction cost nothing and the block can never be null.
+/// The contents are uninitialized. Not copyable or movable; pointers into it would dangle.
+/// </summary>
+/// <typeparam name="Bytes">The capacity of the block.</typeparam>
+/// <typeparam name="Align">The alignment of the storage, a power of two.</typeparam>
+template<size_t Bytes, size_t Align>
+class INLINE_MEMORY_BLOCK
+{
+    static_assert(Bytes > 0, "INLINE_MEMORY_BLOCK: capacity must be non-zero!");
+    static_assert(Align > 0 && (Align & (Align - 1)) == 0, "INLINE_MEMORY_BLOCK: alignment must be a non-zero power of two!");
+
+    private:
+        alignas(Align) unsigned char _Storage[Bytes];
+
+    public:
+
+        INLINE_MEMORY_BLOCK() noexcept { }                 // Deliberately leaves the storage uninitialized
+        ~INLINE_MEMORY_BLOCK() = default;
+
+        INLINE_MEMORY_BLOCK(const INLINE_MEMORY_BLOCK&) = delete;
+        INLINE_MEMORY_BLOCK& operator=(const INLINE_MEMORY_BLOCK&) = delete;
+        INLINE_MEMORY_BLOCK(INLINE_MEMORY_BLOCK&&) = delete;
+        INLINE_MEMORY_BLOCK& operator=(INLINE_MEMORY_BLOCK&&) = delete;
+
+        [[nodiscard]] inline void* GetHead() const noexcept { return const_cast<unsigned char*>(_Storage); }
+        [[nodiscard]] static constexpr size_t GetSize() noexcept { return Bytes; }
+        [[nodiscard]] static constexpr bool IsNullPtr() noexcept { return false; }
+        [[nodiscard]] explicit operator bool() const noexcept { return true; }
+};
+
+#endif
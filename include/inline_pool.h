@@ -0,0 +1,150 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        inline_pool.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __INLINE_POOL_H_GUARD
+#define __INLINE_POOL_H_GUARD
+
+#include <cstddef>      // size_t
+#include <new>          // placement new
+#include "memory_pool.h"
+#include "inline_memory_block.h"
+
+
+/// <summary>
+/// A pool with its storage inside the object, for per-call scratch that should never touch the heap:
+///     INLINE_POOL<1024> scratch;
+///     float* tmp = scratch.TakeArray<float>(64);
+/// Offers the same take API as MEMORY_POOL. When constructed with a fallback pool, requests that no
+/// longer fit inline are served from the fallback instead of failing; the fallback is not owned and
+/// is not reset by this pool, so the caller resets it on whatever cadence it already has.
+/// A spill is not counted as a failure in this pool's statistics; the fallback counts the allocation.
+/// Mind the stack size when placing large capacities in a local variable.
+/// Not copyable. Not thread-safe.
+/// </summary>
+/// <typeparam name="Bytes">The inline capacity in bytes.</typeparam>
+/// <typeparam name="Align">The alignment of the inline storage. Defaults to a cache line.</typeparam>
+template<size_t Bytes, size_t Align = MemoryAlign::CacheLine>
+class INLINE_POOL : public BASIC_MEMORY_POOL<INLINE_MEMORY_BLOCK<Bytes, Align>>
+{
+    private:
+        using BASE = BASIC_MEMORY_POOL<INLINE_MEMORY_BLOCK<Bytes, Align>>;
+
+        MEMORY_POOL* _Fallback = nullptr;       // Serves requests that overflow the inline storage; not owned
+
+        /// <summary>
+        /// Passes through a slice taken from the fallback after the inline take failed. If the fallback
+        /// served it, the failure the inline take just counted is taken back.
+        /// </summary>
+        inline MEMORY_SLICE Spill(MEMORY_SLICE slice) noexcept
+        {
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+            if (!slice.IsNullPtr())
+                --this->_Stats.FailureCount;
+#endif
+            return slice;
+        }
+
+    public:
+
+        /// <summary>
+        /// Creates an empty inline pool.
+        /// </summary>
+        /// <param name="fallback">An optional pool to spill into once the inline storage is full.</param>
+        explicit INLINE_POOL(MEMORY_POOL* fallback = nullptr) noexcept : BASE(), _Fallback(fallback) { }
+
+        ~INLINE_POOL() = default;
+
+        INLINE_POOL(const INLINE_POOL&) = delete;
+        INLINE_POOL& operator=(const INLINE_POOL&) = delete;
+
+        [[nodiscard]] static constexpr size_t Capacity() noexcept { return Bytes; }
+        [[nodiscard]] inline MEMORY_POOL* GetFallback() const noexcept { return _Fallback; }
+
+        /// <summary>
+        /// Carves out a slice of the inline storage, or of the fallback pool once the storage is full.
+        /// </summary>
+        /// <param name="sizeInBytes">The number of bytes requested.</param>
+        /// <returns>The slice, or a null slice if neither the inline storage nor the fallback has room.</returns>
+        inline MEMORY_SLICE TakeSlice(size_t sizeInBytes)
+        {
+            MEMORY_SLICE slice = BASE::TakeSlice(sizeInBytes);
+
+            if (slice.IsNullPtr() && _Fallback != nullptr)
+                return Spill(_Fallback->TakeSlice(sizeInBytes));
+
+            return slice;
+        }
+
+        /// <summary>
+        /// Carves out an aligned slice of the inline storage, or of the fallback pool once the storage is full.
+        /// </summary>
+        /// <param name="sizeInBytes">The number of bytes requested.</param>
+        /// <param name="alignment">The required alignment in bytes. Must be a non-zero power of two.</param>
+        /// <returns>The slice, or a null slice if neither the inline storage nor the fallback has room.</returns>
+        inline MEMORY_SLICE TakeAlignedSlice(size_t sizeInBytes, size_t alignment)
+        {
+            MEMORY_SLICE slice = BASE::TakeAlignedSlice(sizeInBytes, alignment);
+
+            if (slice.IsNullPtr() && _Fallback != nullptr)
+                return Spill(_Fallback->TakeAlignedSlice(sizeInBytes, alignment));
+
+            return slice;
+        }
+
+        /// <summary>
+        /// Allocates a single object of type T and constructs it in place with the provided arguments.
+        /// </summary>
+        /// <returns>A pointer to the constructed object, or nullptr if there is no room.</returns>
+        template<typename T, typename... Args>
+        inline T* Take(Args&&... args)
+        {
+            MEMORY_SLICE slice = TakeSlice(sizeof(T));
+
+            if (slice.IsNullPtr())
+                return nullptr;
+
+            T* ptr = static_cast<T*>(slice.GetHead());
+            new (ptr) T(args...);
+
+            return ptr;
+        }
+
+        /// <summary>
+        /// Allocates a contiguous array of count objects of type T and default-constructs each one.
+        /// </summary>
+        /// <returns>A pointer to the first element, or nullptr if count is zero or there is no room.</returns>
+        template<typename T>
+        inline T* TakeArray(size_t count)
+        {
+            if (count == 0) return nullptr;
+
+            MEMORY_SLICE slice = TakeSlice(sizeof(T) * count);
+
+            if (slice.IsNullPtr())
+                return nullptr;
+
+            T* ptr = static_cast<T*>(slice.GetHead());
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                new (&ptr[i]) T();
+            }
+
+            return ptr;
+        }
+};
+
+#endif
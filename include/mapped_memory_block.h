@@ -0,0 +1,140 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        mapped_memory_block.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MAPPED_MEMORY_BLOCK_H_GUARD
+#define __MAPPED_MEMORY_BLOCK_H_GUARD
+
+#include <cstddef>      // size_t
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <sys/mman.h>   // mmap, munmap, msync
+#include <sys/stat.h>   // fstat
+#include <fcntl.h>      // open
+#include <unistd.h>     // close, ftruncate
+
+
+/// <summary>
+/// A RAII wrapper around a shared, read-write memory mapping of a file.
+/// Opens or creates the file on construction, grows it to the requested size if it is smaller,
+/// and unmaps and closes it on destruction. Writes land in the page cache and reach the file
+/// without any explicit copy; call Flush to force them to disk.
+/// An optional reserved prefix is mapped ahead of the block for callers that keep metadata in the
+/// same file; GetHead and GetSize describe only the region after it.
+/// Failing to open or map the file is a runtime condition rather than a programming mistake, so
+/// construction never asserts; check IsNullPtr or the bool conversion before use.
+/// Not copyable or movable; ownership is strict and non-transferable. POSIX only.
+/// </summary>
+class MAPPED_MEMORY_BLOCK
+{
+    private:
+        void* _Mapping = nullptr;       // Start of the whole mapping, including the reserved prefix
+        size_t _MappingSize = 0;
+        void* _Head = nullptr;          // Start of the usable block, after the reserved prefix
+        size_t _SizeInBytes = 0;
+        int _FileDescriptor = -1;
+        bool _Created = false;          // True if the file was empty or did not exist before construction
+
+    public:
+
+        /// <summary>
+        /// Maps the file at path, creating it if necessary.
+        /// The reserved prefix must be a multiple of the page size for the block head to stay page aligned.
+        /// </summary>
+        /// <param name="path">The file to map.</param>
+        /// <param name="sizeInBytes">The size of the usable block in bytes.</param>
+        /// <param name="reservedPrefix">Bytes mapped ahead of the block for caller metadata. Defaults to 0.</param>
+        MAPPED_MEMORY_BLOCK(const char* path, size_t sizeInBytes, size_t reservedPrefix = 0)
+        {
+            _FileDescriptor = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if (_FileDescriptor < 0)
+                return;
+
+            struct stat info;
+            if (::fstat(_FileDescriptor, &info) != 0)
+                return;
+
+            const size_t total = reservedPrefix + sizeInBytes;
+            _Created = (info.st_size == 0);
+
+            if (static_cast<size_t>(info.st_size) < total && ::ftruncate(_FileDescriptor, static_cast<off_t>(total)) != 0)
+                return;
+
+            void* mapping = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, _FileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+                return;
+
+            _Mapping = mapping;
+            _MappingSize = total;
+            _Head = static_cast<unsigned char*>(mapping) + reservedPrefix;
+            _SizeInBytes = sizeInBytes;
+        }
+
+        /// <summary>
+        /// Unmaps the file and closes its descriptor. Dirty pages are still written back by the kernel.
+        /// </summary>
+        ~MAPPED_MEMORY_BLOCK()
+        {
+            if (_Mapping)
+                ::munmap(_Mapping, _MappingSize);
+
+            if (_FileDescriptor >= 0)
+                ::close(_FileDescriptor);
+        }
+
+        MAPPED_MEMORY_BLOCK(const MAPPED_MEMORY_BLOCK&) = delete;
+        MAPPED_MEMORY_BLOCK& operator=(const MAPPED_MEMORY_BLOCK&) = delete;
+        MAPPED_MEMORY_BLOCK(MAPPED_MEMORY_BLOCK&&) = delete;
+        MAPPED_MEMORY_BLOCK& operator=(MAPPED_MEMORY_BLOCK&&) = delete;
+
+        [[nodiscard]] inline void* GetHead() const noexcept { return _Head; }
+        [[nodiscard]] inline size_t GetSize() const noexcept { return _SizeInBytes; }
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Head == nullptr; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+
+        /// <summary>
+        /// Returns a pointer to the reserved prefix at the start of the mapping, or nullptr if the mapping failed.
+        /// </summary>
+        [[nodiscard]] inline void* GetPrefix() const noexcept { return _Mapping; }
+
+        /// <summary>
+        /// Returns true if the file did not exist or was empty when the block was constructed,
+        /// meaning the mapped contents are all zero rather than data from a previous run.
+        /// </summary>
+        [[nodiscard]] inline bool WasCreated() const noexcept { return _Created; }
+
+        /// <summary>
+        /// Returns the underlying file descriptor, or -1 if the file could not be opened.
+        /// </summary>
+        [[nodiscard]] inline int GetFileDescriptor() const noexcept { return _FileDescriptor; }
+
+        /// <summary>
+        /// Writes dirty pages of the whole mapping, prefix included, back to the file.
+        /// </summary>
+        /// <param name="wait">True to block until the data is on disk; false to only schedule the write-back.</param>
+        /// <returns>True if the flush succeeded or was scheduled; false on error or if the mapping failed.</returns>
+        bool Flush(bool wait = true) noexcept
+        {
+            if (!_Mapping)
+                return false;
+
+            return ::msync(_Mapping, _MappingSize, wait ? MS_SYNC : MS_ASYNC) == 0;
+        }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,82 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_align.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_ALIGN_H_GUARD
+#define __MEMORY_ALIGN_H_GUARD
+
+#include <cstddef>      // size_t, max_align_t
+#include <cstdint>      // uintptr_t
+#include <cstdlib>      // malloc, free, posix_memalign
+
+#if defined(_WIN32)
+#include <malloc.h>     // _aligned_malloc, _aligned_free
+#endif
+
+
+/// <summary>
+/// Heap allocation at a caller-chosen base alignment, the backing for MEMORY_BLOCK.
+/// malloc only guarantees alignof(max_align_t), typically 16 bytes, so a pool over it pays up to
+/// 48 bytes of padding on its first cache-line aligned slice and up to 4080 on its first page aligned one.
+/// </summary>
+namespace MemoryAlign
+{
+    constexpr size_t MallocAlignment = alignof(std::max_align_t);
+    constexpr size_t CacheLine = 64;
+
+    /// <summary>
+    /// Allocates sizeInBytes with the head aligned to alignment.
+    /// Alignments up to MallocAlignment use plain malloc; larger ones use posix_memalign, which glibc
+    /// serves from mmap for large blocks, so page or huge-page alignment costs address space rather than memory.
+    /// </summary>
+    /// <param name="sizeInBytes">The number of bytes to allocate.</param>
+    /// <param name="alignment">The required alignment. Must be a power of two; 0 means MallocAlignment.</param>
+    /// <returns>The aligned head, or nullptr on failure. Release with Free.</returns>
+    [[nodiscard]] inline void* Allocate(size_t sizeInBytes, size_t alignment) noexcept
+    {
+#if defined(_WIN32)
+        return _aligned_malloc(sizeInBytes, alignment > MallocAlignment ? alignment : MallocAlignment);    // Must pair with _aligned_free
+#else
+        if (alignment <= MallocAlignment)
+            return std::malloc(sizeInBytes);
+
+        void* head = nullptr;
+        return ::posix_memalign(&head, alignment, sizeInBytes) == 0 ? head : nullptr;
+#endif
+    }
+
+    /// <summary>
+    /// Releases a block returned by Allocate. Safe on nullptr.
+    /// </summary>
+    inline void Free(void* head) noexcept
+    {
+#if defined(_WIN32)
+        _aligned_free(head);
+#else
+        std::free(head);
+#endif
+    }
+
+    /// <summary>
+    /// Returns the largest power of two dividing ptr's address, or 0 for nullptr.
+    /// </summary>
+    [[nodiscard]] inline size_t AlignmentOf(const void* ptr) noexcept
+    {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        return static_cast<size_t>(address & (~address + 1));
+    }
+}
+
+#endif
@@ -4,16 +4,24 @@
 #define __MEMORY_BLOCK_H_GUARD
 
 #include <cstddef>      // size_t
-#include <malloc.h>     // malloc, free
 #include <cassert>      // assert
+#include "memory_source.h"
+#include "memory_numa.h"
+#include "memory_prefault.h"
 
 /// <summary>
-/// A lightweight RAII wrapper around a single heap-allocated memory block.
+/// A lightweight RAII wrapper around a single memory block obtained from SOURCE.
 /// Owns the memory for its entire lifetime  allocates on construction and frees on destruction.
 /// Intended to be used as the backing storage for higher-level allocators such as MEMORY_POOL.
+/// The head is cache-line aligned by default, so a pool's 64-byte aligned slices need no padding;
+/// pass a larger alignment (e.g. 4096) for page aligned slices or O_DIRECT snapshots.
+/// The source is a compile-time policy (see memory_source.h): the heap by default, or mmap, a static
+/// buffer or user callbacks. It is only consulted on construction and destruction.
 /// Not copyable or movable; ownership is strict and non-transferable.
 /// </summary>
-class MEMORY_BLOCK
+/// <typeparam name="SOURCE">The memory source, providing static Allocate and Release.</typeparam>
+template<typename SOURCE>
+class BASIC_MEMORY_BLOCK
 {
     private:
         void* _Head = nullptr;
@@ -21,30 +29,35 @@ class MEMORY_BLOCK
     public:
 
     /// <summary>
-    /// Allocates a contiguous block of memory of the specified size on the heap.
+    /// Allocates a contiguous block of memory of the specified size from the source.
     /// Asserts on failure, as a null block is considered an unrecoverable error.
     /// </summary>
     /// <param name="sizeInBytes">The number of bytes to allocate.</param>
-    explicit MEMORY_BLOCK(size_t sizeInBytes) : _Head(malloc(sizeInBytes)), _SizeInBytes(sizeInBytes)
+    /// <param name="prefault">True to fault in every page now rather than on first use. Defaults to false.</param>
+    /// <param name="alignment">The alignment of the block head, a power of two. Defaults to a cache line.</param>
+    explicit BASIC_MEMORY_BLOCK(size_t sizeInBytes, bool prefault = false, size_t alignment = MemoryAlign::CacheLine) : _Head(SOURCE::Allocate(sizeInBytes, alignment)), _SizeInBytes(sizeInBytes)
     {
-        assert(_Head != nullptr && "MEMORY_BLOCK: malloc failed");
+        assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "MEMORY_BLOCK: alignment must be a non-zero power of two");
+        assert(_Head != nullptr && "MEMORY_BLOCK: allocation failed");
 
+        if (prefault)
+            MemoryPrefault::Populate(_Head, _SizeInBytes);
     }
 
     /// <summary>
-    /// Releases the allocated memory block back to the heap.
+    /// Releases the allocated memory block back to its source.
     /// Only frees if the block is non-null, making it safe even if construction failed.
     /// </summary>
-    ~MEMORY_BLOCK()
+    ~BASIC_MEMORY_BLOCK()
     {
         if (_Head)
-            free(_Head);
+            SOURCE::Release(_Head, _SizeInBytes);
     }
 
-    MEMORY_BLOCK(const MEMORY_BLOCK&) = delete;
-    MEMORY_BLOCK& operator=(const MEMORY_BLOCK&) = delete;
-    MEMORY_BLOCK(MEMORY_BLOCK&&) = delete;
-    MEMORY_BLOCK& operator=(MEMORY_BLOCK&&) = delete;
+    BASIC_MEMORY_BLOCK(const BASIC_MEMORY_BLOCK&) = delete;
+    BASIC_MEMORY_BLOCK& operator=(const BASIC_MEMORY_BLOCK&) = delete;
+    BASIC_MEMORY_BLOCK(BASIC_MEMORY_BLOCK&&) = delete;
+    BASIC_MEMORY_BLOCK& operator=(BASIC_MEMORY_BLOCK&&) = delete;
 
     /// <summary>
     /// Returns a pointer to the start of the allocated memory block.
@@ -73,7 +86,21 @@ class MEMORY_BLOCK
     /// <returns>True if the block is non-null and valid; otherwise false.</returns>
     [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
 
+    /// <summary>
+    /// Binds the block's memory to a NUMA node so its pages are placed there rather than on whichever
+    /// node first touches them. Call before writing to the block; pages already touched are migrated.
+    /// The partial pages at either end of the block are shared with the heap and are left unbound.
+    /// </summary>
+    /// <param name="node">The target NUMA node.</param>
+    /// <returns>True if the block was bound, or node is 0 on a single-node machine; otherwise false.</returns>
+    inline bool BindToNode(unsigned node) noexcept { return MemoryNuma::BindToNode(_Head, _SizeInBytes, node); }
+
 
 };
 
+/// <summary>
+/// The standard heap-backed block.
+/// </summary>
+using MEMORY_BLOCK = BASIC_MEMORY_BLOCK<HEAP_MEMORY_SOURCE>;
+
 #endif
@@ -0,0 +1,54 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_block_view.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_BLOCK_VIEW_H_GUARD
+#define __MEMORY_BLOCK_VIEW_H_GUARD
+
+#include <cstddef>      // size_t
+
+
+/// <summary>
+/// A non-owning block over memory that belongs to someone else, such as a region of a larger block.
+/// Lets BASIC_MEMORY_POOL run over a sub-range without allocating; the owner must outlive the view.
+/// Not copyable or movable, like the owning blocks.
+/// </summary>
+class MEMORY_BLOCK_VIEW
+{
+    private:
+        void* _Head = nullptr;
+        size_t _SizeInBytes = 0;
+
+    public:
+
+        /// <summary>
+        /// Views sizeInBytes of memory starting at head.
+        /// </summary>
+        MEMORY_BLOCK_VIEW(void* head, size_t sizeInBytes) noexcept : _Head(head), _SizeInBytes(head ? sizeInBytes : 0) { }
+
+        ~MEMORY_BLOCK_VIEW() = default;
+
+        MEMORY_BLOCK_VIEW(const MEMORY_BLOCK_VIEW&) = delete;
+        MEMORY_BLOCK_VIEW& operator=(const MEMORY_BLOCK_VIEW&) = delete;
+        MEMORY_BLOCK_VIEW(MEMORY_BLOCK_VIEW&&) = delete;
+        MEMORY_BLOCK_VIEW& operator=(MEMORY_BLOCK_VIEW&&) = delete;
+
+        [[nodiscard]] inline void* GetHead() const noexcept { return _Head; }
+        [[nodiscard]] inline size_t GetSize() const noexcept { return _SizeInBytes; }
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Head == nullptr; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+};
+
+#endif
@@ -0,0 +1,181 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_budget.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_BUDGET_H_GUARD
+#define __MEMORY_BUDGET_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cassert>      // assert
+
+
+/// <summary>
+/// A byte budget shared by everything that holds memory on behalf of one owner, such as a
+/// MEMORY_MANAGER and the growable pools created alongside it.
+///
+/// Holders call TryCharge before taking memory and Release after giving it back. Pressure callbacks
+/// registered at a threshold fire when a charge carries usage up across that threshold, so the owner
+/// can trim caches or shrink idle pools before the hard limit is reached; when a charge would exceed the
+/// limit itself, every callback is given a chance to free memory and the charge is retried once.
+/// Callbacks may release memory back to this budget, but must not charge it.
+/// Not copyable. Not thread-safe.
+/// </summary>
+class MEMORY_BUDGET
+{
+    public:
+        using PRESSURE_CALLBACK = void (*)(void* context, size_t usedBytes, size_t limitBytes);
+
+        static constexpr size_t Unlimited = ~size_t(0);
+        static constexpr size_t MaxCallbacks = 8;
+
+    private:
+        struct PRESSURE_ENTRY
+        {
+            size_t ThresholdBytes;
+            PRESSURE_CALLBACK Callback;
+            void* Context;
+        };
+
+        size_t _LimitBytes = Unlimited;
+        size_t _UsedBytes = 0;
+        size_t _PeakBytes = 0;
+        size_t _FailedCharges = 0;
+        PRESSURE_ENTRY _Callbacks[MaxCallbacks] = {};
+        size_t _CallbackCount = 0;
+        bool _Notifying = false;                // Guards against callbacks re-entering through a nested charge
+
+        /// <summary>
+        /// Fires every callback whose threshold lies in (from, to], or every callback when all is set.
+        /// Callbacks are told the bytes actually charged, never a prospective total.
+        /// </summary>
+        void Notify(size_t from, size_t to, bool all) noexcept
+        {
+            if (_Notifying)
+                return;
+
+            _Notifying = true;
+            for (size_t i = 0; i < _CallbackCount; ++i)
+            {
+                const PRESSURE_ENTRY& entry = _Callbacks[i];
+                if (all || (from < entry.ThresholdBytes && entry.ThresholdBytes <= to))
+                    entry.Callback(entry.Context, _UsedBytes, _LimitBytes);
+            }
+            _Notifying = false;
+        }
+
+        [[nodiscard]] inline bool Fits(size_t sizeInBytes) const noexcept
+        {
+            return _UsedBytes <= _LimitBytes && sizeInBytes <= _LimitBytes - _UsedBytes;
+        }
+
+        [[nodiscard]] static inline size_t SaturatingAdd(size_t a, size_t b) noexcept
+        {
+            return b > Unlimited - a ? Unlimited : a + b;
+        }
+
+    public:
+
+        /// <summary>
+        /// Creates a budget with the given limit.
+        /// </summary>
+        /// <param name="limitBytes">The maximum number of bytes that may be charged. Defaults to Unlimited.</param>
+        explicit MEMORY_BUDGET(size_t limitBytes = Unlimited) noexcept : _LimitBytes(limitBytes) { }
+
+        MEMORY_BUDGET(const MEMORY_BUDGET&) = delete;
+        MEMORY_BUDGET& operator=(const MEMORY_BUDGET&) = delete;
+        MEMORY_BUDGET(MEMORY_BUDGET&&) = delete;
+        MEMORY_BUDGET& operator=(MEMORY_BUDGET&&) = delete;
+
+        [[nodiscard]] inline size_t GetLimit() const noexcept { return _LimitBytes; }
+        [[nodiscard]] inline size_t GetUsed() const noexcept { return _UsedBytes; }
+        [[nodiscard]] inline size_t GetPeak() const noexcept { return _PeakBytes; }
+        [[nodiscard]] inline size_t GetFailedCharges() const noexcept { return _FailedCharges; }
+        [[nodiscard]] inline size_t GetHeadroom() const noexcept { return _UsedBytes < _LimitBytes ? _LimitBytes - _UsedBytes : 0; }
+
+        /// <summary>
+        /// True while pressure callbacks are running, so holders can free memory outright instead of caching it.
+        /// </summary>
+        [[nodiscard]] inline bool InPressureCallback() const noexcept { return _Notifying; }
+
+        /// <summary>
+        /// Changes the limit. Memory already charged is kept even if it now exceeds the limit;
+        /// further charges fail until enough is released.
+        /// </summary>
+        inline void SetLimit(size_t limitBytes) noexcept { _LimitBytes = limitBytes; }
+
+        /// <summary>
+        /// Registers a function to call when usage rises across thresholdBytes, and whenever a charge
+        /// would exceed the limit. Callbacks run in registration order.
+        /// </summary>
+        /// <returns>True if registered; false if MaxCallbacks are already registered.</returns>
+        bool AddPressureCallback(size_t thresholdBytes, PRESSURE_CALLBACK callback, void* context = nullptr) noexcept
+        {
+            assert(callback != nullptr && "AddPressureCallback: callback cannot be null!");
+
+            if (callback == nullptr || _CallbackCount == MaxCallbacks)
+                return false;
+
+            _Callbacks[_CallbackCount++] = PRESSURE_ENTRY{ thresholdBytes, callback, context };
+            return true;
+        }
+
+        /// <summary>
+        /// Charges sizeInBytes against the budget, firing pressure callbacks for any threshold crossed.
+        /// If the charge would exceed the limit, all callbacks are invoked to free memory and the charge is retried once.
+        /// </summary>
+        /// <returns>True if the bytes were charged; false if they still do not fit.</returns>
+        [[nodiscard]] bool TryCharge(size_t sizeInBytes) noexcept
+        {
+            if (!Fits(sizeInBytes))
+            {
+                Notify(_UsedBytes, SaturatingAdd(_UsedBytes, sizeInBytes), true);
+
+                if (!Fits(sizeInBytes))
+                {
+                    ++_FailedCharges;
+                    return false;
+                }
+            }
+
+            ForceCharge(sizeInBytes);
+            return true;
+        }
+
+        /// <summary>
+        /// Charges sizeInBytes unconditionally, for memory that is already held (e.g. fixed pools
+        /// allocated at startup). Still fires threshold callbacks.
+        /// </summary>
+        void ForceCharge(size_t sizeInBytes) noexcept
+        {
+            const size_t before = _UsedBytes;
+            _UsedBytes = SaturatingAdd(_UsedBytes, sizeInBytes);
+
+            if (_UsedBytes > _PeakBytes)
+                _PeakBytes = _UsedBytes;
+
+            Notify(before, _UsedBytes, false);
+        }
+
+        /// <summary>
+        /// Returns sizeInBytes to the budget.
+        /// </summary>
+        inline void Release(size_t sizeInBytes) noexcept
+        {
+            assert(sizeInBytes <= _UsedBytes && "Release: releasing more than was charged!");
+            _UsedBytes -= sizeInBytes <= _UsedBytes ? sizeInBytes : _UsedBytes;
+        }
+};
+
+#endif
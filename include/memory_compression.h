@@ -0,0 +1,396 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_compression.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_COMPRESSION_H_GUARD
+#define __MEMORY_COMPRESSION_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint16_t, uint32_t, uint64_t
+#include <cstring>      // memcpy, memset
+#include <cassert>      // assert
+#include "memory_slice.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // _BitScanForward64
+#endif
+
+
+/// <summary>
+/// Lightweight block compression between two MEMORY_SLICEs.
+/// The encoded stream follows the LZ4 block format (token, literals, 16-bit offset, match length),
+/// so output can be decoded by any LZ4 block decoder and vice versa.
+/// Neither direction allocates; the compressor keeps its 16 KB match table on the stack.
+/// Both functions report failure by returning 0 rather than writing past the destination.
+/// Because 0 means failure, empty input is rejected: Compress returns 0 for a size of 0 instead of
+/// emitting the one-byte empty LZ4 block, which Decompress could only report as 0 bytes.
+/// </summary>
+namespace MemoryCompression
+{
+    namespace Detail
+    {
+        constexpr size_t HashLog        = 12;           // 4096 entry match table
+        constexpr size_t MinMatch       = 4;            // Shortest encodable match
+        constexpr size_t LastLiterals   = 5;            // Trailing bytes that are always emitted as literals
+        constexpr size_t MatchFindLimit = 12;           // A match may not start within this many bytes of the end
+        constexpr size_t MaxOffset      = 65535;        // 16-bit back reference window
+
+        [[nodiscard]] inline uint32_t Read32(const unsigned char* p) noexcept
+        {
+            uint32_t v;
+            std::memcpy(&v, p, 4);
+            return v;
+        }
+
+        [[nodiscard]] inline uint64_t Read64(const unsigned char* p) noexcept
+        {
+            uint64_t v;
+            std::memcpy(&v, p, 8);
+            return v;
+        }
+
+        [[nodiscard]] inline uint32_t Hash(uint32_t sequence) noexcept
+        {
+            return (sequence * 2654435761u) >> (32 - HashLog);
+        }
+
+        /// <summary>
+        /// Returns the number of leading bytes that are equal in a and b, scanning no further than limit.
+        /// Compares 8 bytes per step on little-endian targets.
+        /// </summary>
+        [[nodiscard]] inline size_t CountMatch(const unsigned char* a, const unsigned char* b, const unsigned char* limit) noexcept
+        {
+            const unsigned char* start = a;
+
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            while (a + 8 <= limit)
+            {
+                const uint64_t diff = Read64(a) ^ Read64(b);
+                if (diff != 0)
+                {
+#if defined(_MSC_VER)
+                    unsigned long bit;
+                    _BitScanForward64(&bit, diff);
+                    return static_cast<size_t>(a - start) + (bit >> 3);
+#else
+                    return static_cast<size_t>(a - start) + (static_cast<size_t>(__builtin_ctzll(diff)) >> 3);
+#endif
+                }
+                a += 8;
+                b += 8;
+            }
+#endif
+
+            while (a < limit && *a == *b)
+            {
+                ++a;
+                ++b;
+            }
+
+            return static_cast<size_t>(a - start);
+        }
+
+        /// <summary>
+        /// Writes the 255-run extension bytes for a length field whose nibble overflowed.
+        /// </summary>
+        inline unsigned char* WriteLength(unsigned char* op, size_t length) noexcept
+        {
+            while (length >= 255)
+            {
+                *op++ = 255;
+                length -= 255;
+            }
+            *op++ = static_cast<unsigned char>(length);
+            return op;
+        }
+
+        /// <summary>
+        /// Emits a single sequence: token, literal run and, when matchLength is non-zero, a back reference.
+        /// Returns nullptr if the sequence does not fit before oend.
+        /// </summary>
+        inline unsigned char* WriteSequence(unsigned char* op, unsigned char* oend, const unsigned char* literals, size_t literalLength, size_t offset, size_t matchLength) noexcept
+        {
+            const size_t worstCase = 1 + literalLength + (literalLength / 255 + 1) + (matchLength ? 2 + (matchLength / 255 + 1) : 0);
+            if (worstCase > static_cast<size_t>(oend - op))
+                return nullptr;
+
+            unsigned char* token = op++;
+            unsigned char tokenValue = 0;
+
+            if (literalLength >= 15)
+            {
+                tokenValue = 15 << 4;
+                op = WriteLength(op, literalLength - 15);
+            }
+            else
+            {
+                tokenValue = static_cast<unsigned char>(literalLength << 4);
+            }
+
+            std::memcpy(op, literals, literalLength);
+            op += literalLength;
+
+            if (matchLength)
+            {
+                *op++ = static_cast<unsigned char>(offset);
+                *op++ = static_cast<unsigned char>(offset >> 8);
+
+                const size_t code = matchLength - MinMatch;
+                if (code >= 15)
+                {
+                    tokenValue |= 15;
+                    op = WriteLength(op, code - 15);
+                }
+                else
+                {
+                    tokenValue |= static_cast<unsigned char>(code);
+                }
+            }
+
+            *token = tokenValue;
+            return op;
+        }
+    }
+
+    /// <summary>
+    /// Returns the largest compressed size that an input of the given size can produce.
+    /// Sizing the destination slice to this value guarantees Compress cannot fail.
+    /// </summary>
+    /// <param name="sizeInBytes">The size of the uncompressed input.</param>
+    /// <returns>The worst case compressed size in bytes.</returns>
+    [[nodiscard]] constexpr size_t CompressBound(size_t sizeInBytes) noexcept
+    {
+        return sizeInBytes + (sizeInBytes / 255) + 16;
+    }
+
+    /// <summary>
+    /// Compresses the first sizeInBytes bytes of src into dst.
+    /// Asserts in debug if either slice is null, the slices overlap or sizeInBytes exceeds the source slice.
+    /// </summary>
+    /// <param name="src">The slice holding the uncompressed data.</param>
+    /// <param name="sizeInBytes">The number of bytes of src to compress.</param>
+    /// <param name="dst">The slice to write the compressed stream into.</param>
+    /// <returns>The compressed size in bytes, or 0 if sizeInBytes is 0 or dst is too small.</returns>
+    [[nodiscard]] inline size_t Compress(const MEMORY_SLICE& src, size_t sizeInBytes, const MEMORY_SLICE& dst) noexcept
+    {
+        using namespace Detail;
+
+        assert(!src.IsNullPtr() && "Compress: cannot compress a null slice!");
+        assert(!dst.IsNullPtr() && "Compress: cannot compress into a null slice!");
+        assert(sizeInBytes <= src.GetSize() && "Compress: size exceeds source slice!");
+        assert(!src.Contains(dst.GetHead()) && !dst.Contains(src.GetHead()) && "Compress: source and destination overlap!");
+
+        if (sizeInBytes == 0 || sizeInBytes > src.GetSize())                   // Nothing to encode; see the namespace notes
+            return 0;
+
+        const unsigned char* const base = static_cast<const unsigned char*>(src.GetHead());
+        const unsigned char* const iend = base + sizeInBytes;
+        unsigned char* const obase = static_cast<unsigned char*>(dst.GetHead());
+        unsigned char* const oend = obase + dst.GetSize();
+
+        const unsigned char* anchor = base;
+        unsigned char* op = obase;
+
+        if (sizeInBytes > MatchFindLimit)
+        {
+            const unsigned char* const mflimit = iend - MatchFindLimit;
+            const unsigned char* const matchlimit = iend - LastLiterals;
+
+            uint32_t table[size_t(1) << HashLog];
+            std::memset(table, 0, sizeof(table));
+
+            const unsigned char* ip = base + 1;
+
+            while (ip < mflimit)
+            {
+                const uint32_t h = Hash(Read32(ip));
+                const unsigned char* ref = base + table[h];
+                table[h] = static_cast<uint32_t>(ip - base);
+
+                if (ref >= ip || static_cast<size_t>(ip - ref) > MaxOffset || Read32(ref) != Read32(ip))
+                {
+                    ip += 1 + (static_cast<size_t>(ip - anchor) >> 6);              // Skip faster through incompressible runs
+                    continue;
+                }
+
+                while (ip > anchor && ref > base && ip[-1] == ref[-1])              // Extend the match backwards into the literal run
+                {
+                    --ip;
+                    --ref;
+                }
+
+                const size_t matchLength = MinMatch + CountMatch(ip + MinMatch, ref + MinMatch, matchlimit);
+
+                op = WriteSequence(op, oend, anchor, static_cast<size_t>(ip - anchor), static_cast<size_t>(ip - ref), matchLength);
+                if (!op)
+                    return 0;
+
+                ip += matchLength;
+                anchor = ip;
+
+                if (ip < mflimit)                                                   // Seed the table with the tail of the match
+                    table[Hash(Read32(ip - 2))] = static_cast<uint32_t>(ip - 2 - base);
+            }
+        }
+
+        op = WriteSequence(op, oend, anchor, static_cast<size_t>(iend - anchor), 0, 0);
+        if (!op)
+            return 0;
+
+        return static_cast<size_t>(op - obase);
+    }
+
+    /// <summary>
+    /// Compresses the entire src slice into dst.
+    /// </summary>
+    /// <param name="src">The slice holding the uncompressed data.</param>
+    /// <param name="dst">The slice to write the compressed stream into.</param>
+    /// <returns>The compressed size in bytes, or 0 if src is empty or dst is too small.</returns>
+    [[nodiscard]] inline size_t Compress(const MEMORY_SLICE& src, const MEMORY_SLICE& dst) noexcept
+    {
+        return Compress(src, src.GetSize(), dst);
+    }
+
+    /// <summary>
+    /// Decompresses a stream produced by Compress (or any LZ4 block encoder) into dst.
+    /// Every length and offset is validated against both slices, so malformed input fails
+    /// instead of reading or writing out of bounds.
+    /// Asserts in debug if either slice is null or compressedSize exceeds the source slice.
+    /// </summary>
+    /// <param name="src">The slice holding the compressed stream.</param>
+    /// <param name="compressedSize">The number of bytes of src that make up the stream.</param>
+    /// <param name="dst">The slice to write the decompressed data into.</param>
+    /// <returns>The decompressed size in bytes, or 0 if the stream is malformed, dst is too small, or the stream is an
+    /// empty block from another encoder (Compress never produces one).</returns>
+    [[nodiscard]] inline size_t Decompress(const MEMORY_SLICE& src, size_t compressedSize, const MEMORY_SLICE& dst) noexcept
+    {
+        using namespace Detail;
+
+        assert(!src.IsNullPtr() && "Decompress: cannot decompress a null slice!");
+        assert(!dst.IsNullPtr() && "Decompress: cannot decompress into a null slice!");
+        assert(compressedSize <= src.GetSize() && "Decompress: size exceeds source slice!");
+
+        if (compressedSize == 0 || compressedSize > src.GetSize())
+            return 0;
+
+        const unsigned char* ip = static_cast<const unsigned char*>(src.GetHead());
+        const unsigned char* const iend = ip + compressedSize;
+        unsigned char* const obase = static_cast<unsigned char*>(dst.GetHead());
+        unsigned char* op = obase;
+        unsigned char* const oend = obase + dst.GetSize();
+
+        for (;;)
+        {
+            const unsigned char token = *ip++;
+
+            size_t literalLength = token >> 4;
+            if (literalLength == 15)
+            {
+                unsigned char b;
+                do
+                {
+                    if (ip >= iend)
+                        return 0;
+                    b = *ip++;
+                    literalLength += b;
+                } while (b == 255);
+            }
+
+            if (literalLength > static_cast<size_t>(iend - ip) || literalLength > static_cast<size_t>(oend - op))
+                return 0;
+
+            if (literalLength <= 16 && iend - ip >= 16 && oend - op >= 16)        // Fixed-size copy; trailing bytes are overwritten later
+                std::memcpy(op, ip, 16);
+            else
+                std::memcpy(op, ip, literalLength);
+            op += literalLength;
+            ip += literalLength;
+
+            if (ip == iend)                                                         // The final sequence carries literals only
+                break;
+
+            if (iend - ip < 2)
+                return 0;
+
+            const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+
+            if (offset == 0 || offset > static_cast<size_t>(op - obase))
+                return 0;
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15)
+            {
+                unsigned char b;
+                do
+                {
+                    if (ip >= iend)
+                        return 0;
+                    b = *ip++;
+                    matchLength += b;
+                } while (b == 255);
+            }
+            matchLength += MinMatch;
+
+            if (matchLength > static_cast<size_t>(oend - op))
+                return 0;
+
+            const unsigned char* match = op - offset;
+
+            if (offset >= 16 && static_cast<size_t>(oend - op) >= matchLength + 16) // Wild copy in 16-byte steps with room to overshoot
+            {
+                unsigned char* const end = op + matchLength;
+                do
+                {
+                    std::memcpy(op, match, 16);
+                    op += 16;
+                    match += 16;
+                } while (op < end);
+                op = end;
+            }
+            else if (offset >= matchLength)                                         // Source and destination do not overlap
+            {
+                std::memcpy(op, match, matchLength);
+                op += matchLength;
+            }
+            else if (offset >= 8)                                                   // Overlapping, but 8-byte steps never read unwritten bytes
+            {
+                unsigned char* const end = op + matchLength;
+                while (op + 8 <= end)
+                {
+                    std::memcpy(op, match, 8);
+                    op += 8;
+                    match += 8;
+                }
+                while (op < end)
+                    *op++ = *match++;
+            }
+            else                                                                    // Short period run, replicate byte by byte
+            {
+                unsigned char* const end = op + matchLength;
+                while (op < end)
+                    *op++ = *match++;
+            }
+
+            if (ip >= iend)                                                         // A stream must end with a literal-only sequence
+                return 0;
+        }
+
+        return static_cast<size_t>(op - obase);
+    }
+}
+
+
+#endif
@@ -0,0 +1,259 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_debug.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_DEBUG_H_GUARD
+#define __MEMORY_DEBUG_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uintptr_t
+#include "memory_align.h"
+
+
+// ----------------------------------------------------------------------------
+// Overrun detection for pools.
+//
+// Define MEMORYCPP_POOL_DEBUG (consistently, in every translation unit) to turn on:
+//   - Guard pages: MEMORY_BLOCK maps its memory with an inaccessible page on either side, and
+//     places the block so that its last byte touches the trailing guard, or comes as close as the
+//     block's alignment allows.
+//   - Canaries: every slice is followed by a 16-byte record holding a fixed pattern and the offset
+//     of the previous record. Reset walks the chain and asserts if any record was overwritten.
+// Both are ignored when NDEBUG is defined, so release builds keep the plain bump path.
+//
+// Independently, when the build uses AddressSanitizer, pools keep everything above the allocation
+// position poisoned, from construction and again after each Reset, and unpoison each slice as it is
+// taken, so an overrun past the last slice or a stale pointer into a reset pool is reported at the
+// faulting access.
+// ----------------------------------------------------------------------------
+
+#if defined(MEMORYCPP_POOL_DEBUG) && !defined(NDEBUG)
+#define MEMORYCPP_POOL_DEBUG_ENABLED 1
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define MEMORYCPP_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define MEMORYCPP_ASAN 1
+#endif
+#endif
+
+#if defined(MEMORYCPP_ASAN)
+#include <cstdlib>                      // realloc, free
+#include <sanitizer/asan_interface.h>   // ASAN_POISON_MEMORY_REGION, ASAN_UNPOISON_MEMORY_REGION
+#endif
+
+#if defined(MEMORYCPP_ASAN) && defined(_MSC_VER)
+#define MEMORYCPP_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#elif defined(MEMORYCPP_ASAN)
+#define MEMORYCPP_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define MEMORYCPP_NO_SANITIZE_ADDRESS
+#endif
+
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/mman.h>   // mmap, munmap, mprotect
+#include <unistd.h>     // sysconf
+#endif
+
+
+/// <summary>
+/// Support routines for the pool debug mode. Every function is an empty inline when its feature is off.
+/// </summary>
+namespace MemoryDebug
+{
+    /// <summary>
+    /// The record written after each slice in debug mode.
+    /// </summary>
+    struct CANARY
+    {
+        static constexpr uint64_t ExpectedPattern = 0xFDFDFDFDC0DEFDFDull;
+
+        uint64_t Pattern;
+        uint64_t Previous;      // Offset of the previous record plus one; 0 ends the chain
+    };
+
+    inline void Poison(const void* head, size_t sizeInBytes) noexcept
+    {
+#if defined(MEMORYCPP_ASAN)
+        ASAN_POISON_MEMORY_REGION(head, sizeInBytes);
+#else
+        (void)head;
+        (void)sizeInBytes;
+#endif
+    }
+
+    inline void Unpoison(const void* head, size_t sizeInBytes) noexcept
+    {
+#if defined(MEMORYCPP_ASAN)
+        ASAN_UNPOISON_MEMORY_REGION(head, sizeInBytes);
+#else
+        (void)head;
+        (void)sizeInBytes;
+#endif
+    }
+
+    /// <summary>
+    /// Unpoisons a range for the lifetime of the scope, then puts back exactly the poisoned runs it found,
+    /// for code that must read a region wholesale without losing the poison on padding and canaries.
+    /// Only the shadow state changes, never the bytes. Meant for ranges with short poisoned runs, such as
+    /// the used part of a pool; if the run list cannot be allocated the range is left unpoisoned.
+    /// An empty type when AddressSanitizer is off.
+    /// </summary>
+    class UNPOISON_SCOPE
+    {
+#if defined(MEMORYCPP_ASAN)
+            const char* _Head;
+            size_t* _Runs = nullptr;        // Offset and length pairs
+            size_t _RunCount = 0;
+
+        public:
+            UNPOISON_SCOPE(const void* head, size_t sizeInBytes) noexcept : _Head(static_cast<const char*>(head))
+            {
+                const char* end = _Head + sizeInBytes;
+                const char* cursor = _Head;
+                size_t capacity = 0;
+
+                while (head != nullptr && cursor < end)
+                {
+                    const char* first = static_cast<const char*>(__asan_region_is_poisoned(const_cast<char*>(cursor), static_cast<size_t>(end - cursor)));
+                    if (first == nullptr)
+                        break;
+
+                    const char* last = first + 1;
+                    while (last < end && __asan_address_is_poisoned(last))
+                        ++last;
+
+                    if (_RunCount == capacity)
+                    {
+                        capacity = capacity ? capacity * 2 : 16;
+                        size_t* grown = static_cast<size_t*>(std::realloc(_Runs, capacity * 2 * sizeof(size_t)));
+                        if (grown == nullptr)
+                        {
+                            _RunCount = 0;
+                            break;
+                        }
+                        _Runs = grown;
+                    }
+
+                    _Runs[_RunCount * 2] = static_cast<size_t>(first - _Head);
+                    _Runs[_RunCount * 2 + 1] = static_cast<size_t>(last - first);
+                    ++_RunCount;
+                    cursor = last;
+                }
+
+                if (head != nullptr)
+                    Unpoison(head, sizeInBytes);
+            }
+
+            ~UNPOISON_SCOPE()
+            {
+                for (size_t i = 0; i < _RunCount; ++i)
+                    Poison(_Head + _Runs[i * 2], _Runs[i * 2 + 1]);
+
+                std::free(_Runs);
+            }
+#else
+        public:
+            UNPOISON_SCOPE(const void* head, size_t sizeInBytes) noexcept
+            {
+                (void)head;
+                (void)sizeInBytes;
+            }
+#endif
+
+            UNPOISON_SCOPE(const UNPOISON_SCOPE&) = delete;
+            UNPOISON_SCOPE& operator=(const UNPOISON_SCOPE&) = delete;
+    };
+
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+
+    namespace Detail
+    {
+        [[nodiscard]] inline size_t PageSize() noexcept
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#else
+            return 4096;
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Allocates sizeInBytes between two inaccessible guard pages, with the end of the block placed
+    /// against the trailing guard, less whatever rounding the head's alignment needs (under 16 bytes at
+    /// the default alignment). Falls back to an unguarded MemoryAlign::Allocate where guard pages are unavailable.
+    /// </summary>
+    /// <param name="sizeInBytes">The number of bytes to allocate.</param>
+    /// <param name="alignment">The required head alignment, a power of two; raised to at least 16.</param>
+    /// <returns>The block head, or nullptr on failure.</returns>
+    [[nodiscard]] inline void* AllocateGuarded(size_t sizeInBytes, size_t alignment) noexcept
+    {
+        if (alignment < 16)
+            alignment = 16;
+
+#if defined(__unix__) || defined(__APPLE__)
+        const size_t pageSize = Detail::PageSize();
+        const size_t dataBytes = (sizeInBytes + alignment - 1 + pageSize - 1) / pageSize * pageSize;     // Room to align the head down
+        const size_t mappingBytes = dataBytes + 2 * pageSize;
+
+        void* mapping = ::mmap(nullptr, mappingBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED)
+            return nullptr;
+
+        const uintptr_t base = reinterpret_cast<uintptr_t>(mapping);
+        const uintptr_t head = (base + pageSize + dataBytes - sizeInBytes) & ~(uintptr_t(alignment) - 1);
+        const uintptr_t leading = (head & ~(uintptr_t(pageSize) - 1)) - pageSize;
+        const uintptr_t trailing = (head + sizeInBytes + pageSize - 1) & ~(uintptr_t(pageSize) - 1);
+
+        if (leading > base)                                                         // Alignment slack beyond the guards goes back, so
+            ::munmap(mapping, leading - base);                                      // FreeGuarded can find the mapping from head alone
+        if (trailing + pageSize < base + mappingBytes)
+            ::munmap(reinterpret_cast<void*>(trailing + pageSize), base + mappingBytes - trailing - pageSize);
+
+        ::mprotect(reinterpret_cast<void*>(leading), pageSize, PROT_NONE);
+        ::mprotect(reinterpret_cast<void*>(trailing), pageSize, PROT_NONE);
+
+        return reinterpret_cast<void*>(head);
+#else
+        return MemoryAlign::Allocate(sizeInBytes, alignment);
+#endif
+    }
+
+    /// <summary>
+    /// Releases a block returned by AllocateGuarded.
+    /// </summary>
+    inline void FreeGuarded(void* head, size_t sizeInBytes) noexcept
+    {
+        if (head == nullptr)
+            return;
+
+#if defined(__unix__) || defined(__APPLE__)
+        const size_t pageSize = Detail::PageSize();
+        const uintptr_t leading = (reinterpret_cast<uintptr_t>(head) & ~(uintptr_t(pageSize) - 1)) - pageSize;
+        const uintptr_t trailing = (reinterpret_cast<uintptr_t>(head) + sizeInBytes + pageSize - 1) & ~(uintptr_t(pageSize) - 1);
+
+        ::munmap(reinterpret_cast<void*>(leading), trailing + pageSize - leading);
+#else
+        MemoryAlign::Free(head);
+#endif
+    }
+
+#endif
+}
+
+#endif
@@ -0,0 +1,297 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_delta.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_DELTA_H_GUARD
+#define __MEMORY_DELTA_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <cstring>      // memcpy
+#include <cassert>      // assert
+#include "memory_slice.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __MEMORY_DELTA_SSE2 1
+#include <emmintrin.h>  // _mm_loadu_si128, _mm_cmpeq_epi8, _mm_movemask_epi8
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // _BitScanForward64
+#endif
+
+
+/// <summary>
+/// Byte-level delta encoding between two equally sized MEMORY_SLICEs.
+/// Diff walks both slices 16 bytes at a time (SSE2 where available, 64-bit words otherwise) and
+/// emits the changed byte ranges as run-length records; Apply replays those records onto a target.
+///
+/// Stream layout, all integers are LEB128 varints:
+///     sliceSize
+///     { skip, length, length bytes of new data }*
+/// where skip counts unchanged bytes since the end of the previous record.
+/// Changed ranges separated by fewer than MergeGap equal bytes are coalesced, since a short gap
+/// costs less to resend than a new record header.
+/// </summary>
+namespace MemoryDelta
+{
+    constexpr size_t MergeGap = 8;          // Equal runs shorter than this are folded into the surrounding record
+
+    namespace Detail
+    {
+        [[nodiscard]] inline size_t CountTrailingZeros(uint64_t value) noexcept
+        {
+#if defined(_MSC_VER)
+            unsigned long bit;
+            _BitScanForward64(&bit, value);
+            return bit;
+#else
+            return static_cast<size_t>(__builtin_ctzll(value));
+#endif
+        }
+
+        /// <summary>
+        /// Returns the first index in [from, size) where a and b differ, or size if they match to the end.
+        /// </summary>
+        [[nodiscard]] inline size_t FindFirstDiff(const unsigned char* a, const unsigned char* b, size_t from, size_t size) noexcept
+        {
+            size_t i = from;
+
+#if defined(__MEMORY_DELTA_SSE2)
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+                const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq)) ^ 0xFFFFu;
+                if (mask)
+                    return i + CountTrailingZeros(mask);
+            }
+#elif !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            for (; i + 8 <= size; i += 8)
+            {
+                uint64_t wa, wb;
+                std::memcpy(&wa, a + i, 8);
+                std::memcpy(&wb, b + i, 8);
+                if (wa != wb)
+                    return i + (CountTrailingZeros(wa ^ wb) >> 3);
+            }
+#endif
+
+            for (; i < size; ++i)
+            {
+                if (a[i] != b[i])
+                    return i;
+            }
+
+            return size;
+        }
+
+        /// <summary>
+        /// Returns the first index in [from, size) where a and b are equal, or size if every byte differs.
+        /// </summary>
+        [[nodiscard]] inline size_t FindFirstEqual(const unsigned char* a, const unsigned char* b, size_t from, size_t size) noexcept
+        {
+            size_t i = from;
+
+#if defined(__MEMORY_DELTA_SSE2)
+            for (; i + 16 <= size; i += 16)
+            {
+                const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+                const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+                if (mask)
+                    return i + CountTrailingZeros(mask);
+            }
+#endif
+
+            for (; i < size; ++i)
+            {
+                if (a[i] == b[i])
+                    return i;
+            }
+
+            return size;
+        }
+
+        [[nodiscard]] constexpr size_t VarintSize(size_t value) noexcept
+        {
+            size_t bytes = 1;
+            while (value >= 0x80)
+            {
+                value >>= 7;
+                ++bytes;
+            }
+            return bytes;
+        }
+
+        inline unsigned char* WriteVarint(unsigned char* op, size_t value) noexcept
+        {
+            while (value >= 0x80)
+            {
+                *op++ = static_cast<unsigned char>(value | 0x80);
+                value >>= 7;
+            }
+            *op++ = static_cast<unsigned char>(value);
+            return op;
+        }
+
+        /// <summary>
+        /// Decodes a varint at ip, advancing ip. Returns false if the stream ends or the value overflows size_t.
+        /// </summary>
+        [[nodiscard]] inline bool ReadVarint(const unsigned char*& ip, const unsigned char* iend, size_t& value) noexcept
+        {
+            value = 0;
+            for (size_t shift = 0; shift < sizeof(size_t) * 8; shift += 7)
+            {
+                if (ip >= iend)
+                    return false;
+
+                const unsigned char b = *ip++;
+                value |= static_cast<size_t>(b & 0x7F) << shift;
+
+                if ((b & 0x80) == 0)
+                    return true;
+            }
+            return false;
+        }
+    }
+
+    /// <summary>
+    /// Returns the largest delta Diff can produce for slices of the given size.
+    /// Sizing the destination slice to this value guarantees Diff cannot fail.
+    /// </summary>
+    /// <param name="sizeInBytes">The size of each compared slice.</param>
+    /// <returns>The worst case delta size in bytes.</returns>
+    [[nodiscard]] constexpr size_t DiffBound(size_t sizeInBytes) noexcept
+    {
+        return sizeInBytes + (sizeInBytes / 4) + 32;
+    }
+
+    /// <summary>
+    /// Encodes the bytes that changed between before and after into dst.
+    /// Asserts in debug if any slice is null or the compared slices differ in size.
+    /// </summary>
+    /// <param name="before">The previous contents.</param>
+    /// <param name="after">The current contents.</param>
+    /// <param name="dst">The slice to write the delta into.</param>
+    /// <returns>The delta size in bytes, or 0 if the slices differ in size or dst is too small.</returns>
+    [[nodiscard]] inline size_t Diff(const MEMORY_SLICE& before, const MEMORY_SLICE& after, const MEMORY_SLICE& dst) noexcept
+    {
+        using namespace Detail;
+
+        assert(!before.IsNullPtr() && !after.IsNullPtr() && "Diff: cannot diff a null slice!");
+        assert(!dst.IsNullPtr() && "Diff: cannot write into a null slice!");
+        assert(before.GetSize() == after.GetSize() && "Diff: slices must be the same size!");
+
+        if (before.GetSize() != after.GetSize())
+            return 0;
+
+        const size_t size = after.GetSize();
+        const unsigned char* a = static_cast<const unsigned char*>(before.GetHead());
+        const unsigned char* b = static_cast<const unsigned char*>(after.GetHead());
+        unsigned char* const obase = static_cast<unsigned char*>(dst.GetHead());
+        unsigned char* const oend = obase + dst.GetSize();
+        unsigned char* op = obase;
+
+        if (VarintSize(size) > dst.GetSize())
+            return 0;
+
+        op = WriteVarint(op, size);
+
+        size_t pos = 0;                                                         // End of the previous record
+        for (;;)
+        {
+            const size_t start = FindFirstDiff(a, b, pos, size);
+            if (start == size)
+                break;
+
+            size_t end = FindFirstEqual(a, b, start, size);
+            while (end < size)                                                  // Swallow equal gaps too short to be worth a record
+            {
+                const size_t next = FindFirstDiff(a, b, end, size);
+                if (next == size || next - end >= MergeGap)
+                    break;
+                end = FindFirstEqual(a, b, next, size);
+            }
+
+            const size_t length = end - start;
+            const size_t needed = VarintSize(start - pos) + VarintSize(length) + length;
+            if (needed > static_cast<size_t>(oend - op))
+                return 0;
+
+            op = WriteVarint(op, start - pos);
+            op = WriteVarint(op, length);
+            std::memcpy(op, b + start, length);
+            op += length;
+
+            pos = end;
+        }
+
+        return static_cast<size_t>(op - obase);
+    }
+
+    /// <summary>
+    /// Replays a delta produced by Diff onto target, turning the "before" contents into the "after" contents.
+    /// The delta is validated against target before each write, so a malformed or mismatched delta
+    /// fails without writing out of bounds. Records preceding the failure point are still applied.
+    /// Asserts in debug if either slice is null or deltaSize exceeds the delta slice.
+    /// </summary>
+    /// <param name="delta">The slice holding the delta stream.</param>
+    /// <param name="deltaSize">The number of bytes of delta that make up the stream.</param>
+    /// <param name="target">The slice to patch. Must be the size the delta was produced for.</param>
+    /// <returns>True if the whole delta was applied; false if it is malformed or sized for a different slice.</returns>
+    [[nodiscard]] inline bool Apply(const MEMORY_SLICE& delta, size_t deltaSize, MEMORY_SLICE& target) noexcept
+    {
+        using namespace Detail;
+
+        assert(!delta.IsNullPtr() && "Apply: cannot read a null delta!");
+        assert(!target.IsNullPtr() && "Apply: cannot patch a null slice!");
+        assert(deltaSize <= delta.GetSize() && "Apply: size exceeds delta slice!");
+
+        if (deltaSize > delta.GetSize())
+            return false;
+
+        const unsigned char* const ibase = static_cast<const unsigned char*>(delta.GetHead());
+        const unsigned char* const iend = ibase + deltaSize;
+        const unsigned char* ip = ibase;
+
+        size_t size;
+        if (!ReadVarint(ip, iend, size) || size != target.GetSize())
+            return false;
+
+        size_t pos = 0;
+        while (ip < iend)
+        {
+            size_t skip, length;
+            if (!ReadVarint(ip, iend, skip) || !ReadVarint(ip, iend, length))
+                return false;
+
+            if (skip > size - pos || length > size - pos - skip || length > static_cast<size_t>(iend - ip))
+                return false;
+
+            pos += skip;
+
+            if (length && !target.CopyFrom(delta, static_cast<size_t>(ip - ibase), pos, length))
+                return false;
+
+            ip += length;
+            pos += length;
+        }
+
+        return true;
+    }
+}
+
+#undef __MEMORY_DELTA_SSE2
+
+#endif
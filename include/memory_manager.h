@@ -21,14 +21,72 @@
 #include "fixed_memory_manager.h"
 #include "dynamic_memory_manager.h"
 #include "memory_units.h"
-
-template<size_t FixedCount, size_t DynamicCount>
+#include "memory_budget.h"
+
+/// <summary>
+/// Combines a FIXED_MEMORY_MANAGER and a DYNAMIC_MEMORY_MANAGER whose pools draw their blocks
+/// from the same SOURCE (see memory_source.h), the heap by default.
+/// Every byte the manager holds (fixed pools, active dynamic pools and recycled ones) is charged to
+/// one MEMORY_BUDGET. CreateDynamicPool fails once the budget refuses, after first trimming the
+/// recycle cache and then invoking the registered pressure callbacks. Growable pools can share the
+/// budget by being constructed with &GetBudget().
+/// </summary>
+template<size_t FixedCount, size_t DynamicCount, typename SOURCE = HEAP_MEMORY_SOURCE>
 class MEMORY_MANAGER
 {
-	
+	public:
+		using POOL = SOURCED_MEMORY_POOL<SOURCE>;
+
+        /// <summary>
+        /// A plain copy of every pool's usage and statistics plus manager-wide totals, as returned by Snapshot.
+        /// Holds no pointers, so it can be copied, stored or written out as is.
+        /// </summary>
+        struct SNAPSHOT
+        {
+            POOL_SNAPSHOT Fixed[FixedCount ? FixedCount : 1];           // Index i is fixed pool i
+            POOL_SNAPSHOT Dynamic[DynamicCount ? DynamicCount : 1];     // Index i is dynamic slot i; empty slots have Exists false
+
+            size_t PoolCount = 0;               // Fixed plus active dynamic pools
+            size_t TotalSize = 0;
+            size_t TotalBytesUsed = 0;
+            size_t TotalMaxBytesUsed = 0;       // Sum of each pool's own high-water mark
+            POOL_STATS TotalStats;
+
+            size_t RecycledBytes = 0;
+            size_t RecycledCount = 0;
+            size_t BudgetUsed = 0;
+            size_t BudgetLimit = 0;
+        };
+
 	private:
-		FIXED_MEMORY_MANAGER<FixedCount> _FixedManager;
-		DYNAMIC_MEMORY_MANAGER<DynamicCount> _DynamicManager;
+		FIXED_MEMORY_MANAGER<FixedCount, SOURCE> _FixedManager;
+		DYNAMIC_MEMORY_MANAGER<DynamicCount, SOURCE> _DynamicManager;
+		MEMORY_BUDGET _Budget;
+		size_t _DynamicCharged = 0;         // Bytes of dynamic pools, active and recycled, charged to _Budget
+
+        /// <summary>
+        /// Brings the budget's dynamic charge in line with what the dynamic manager actually holds.
+        /// </summary>
+        void SyncDynamicCharge() noexcept
+        {
+            const size_t held = _DynamicManager.ActivePoolBytes() + _DynamicManager.GetRecycledBytes();
+
+            if (held > _DynamicCharged)
+                _Budget.ForceCharge(held - _DynamicCharged);
+            else
+                _Budget.Release(_DynamicCharged - held);
+
+            _DynamicCharged = held;
+        }
+
+        /// <summary>
+        /// The first pressure response: parked pools are the cheapest memory to give back.
+        /// Registered with an unreachable threshold so it only runs when a charge would exceed the limit.
+        /// </summary>
+        static void TrimRecycledOnPressure(void* context, size_t, size_t) noexcept
+        {
+            static_cast<MEMORY_MANAGER*>(context)->TrimDynamicRecycled(0);
+        }
 
 
 	public:
@@ -42,6 +100,11 @@ class MEMORY_MANAGER
         {
             // Use FixedCount here, as that is the template parameter name
             static_assert(sizeof...(Args) == FixedCount, "Number of size parameters must match Fixed Pool Count!");
+
+            for (size_t i = 0; i < FixedCount; ++i)
+                _Budget.ForceCharge(_FixedManager.GetPool(i).Size());
+
+            (void)_Budget.AddPressureCallback(MEMORY_BUDGET::Unlimited, &TrimRecycledOnPressure, this);
         }
 
         ~MEMORY_MANAGER() = default;
@@ -62,16 +125,16 @@ class MEMORY_MANAGER
         /// Bounds-checked at compile time.
         /// </summary>
         template<size_t Index>
-        [[nodiscard]] inline MEMORY_POOL& GetFixedPool() noexcept
+        [[nodiscard]] inline POOL& GetFixedPool() noexcept
         {
-            return _FixedManager.GetPool<Index>();
+            return _FixedManager.template GetPool<Index>();
         }
 
         /// <summary>
         /// Returns a reference to the fixed pool at the specified runtime index.
         /// Asserts in debug if the index is out of bounds.
         /// </summary>
-        [[nodiscard]] inline MEMORY_POOL& GetFixedPool(size_t index) noexcept
+        [[nodiscard]] inline POOL& GetFixedPool(size_t index) noexcept
         {
             return _FixedManager.GetPool(index);
         }
@@ -83,7 +146,7 @@ class MEMORY_MANAGER
         template<size_t Index>
         inline void ResetFixedPool() noexcept
         {
-            _FixedManager.ResetPool<Index>();
+            _FixedManager.template ResetPool<Index>();
         }
 
         /// <summary>
@@ -112,31 +175,71 @@ class MEMORY_MANAGER
                 /// <summary>
                 /// Allocates a new dynamic pool at the specified index.
                 /// Asserts in debug if the slot is occupied or out of bounds.
-                /// Returns false in release if the slot is occupied or out of bounds.
+                /// Returns false in release if the slot is occupied or out of bounds,
+                /// or if poolSize does not fit in the budget even after pressure callbacks have run.
                 /// </summary>
         [[nodiscard]] inline bool CreateDynamicPool(size_t index, size_t poolSize) noexcept
         {
-            return _DynamicManager.CreatePool(index, poolSize);
+            if (!ReserveDynamic(poolSize))
+                return false;
+
+            const bool created = _DynamicManager.CreatePool(index, poolSize);
+            SyncDynamicCharge();                                    // Replaces the reservation with what is actually held
+            return created;
+        }
+
+        /// <summary>
+        /// Creates a dynamic pool in the lowest empty slot.
+        /// Returns an invalid handle if every slot is taken or poolSize does not fit in the budget.
+        /// </summary>
+        [[nodiscard]] inline POOL_HANDLE CreateDynamicPoolAnySlot(size_t poolSize) noexcept
+        {
+            if (!ReserveDynamic(poolSize))
+                return POOL_HANDLE();
+
+            const POOL_HANDLE handle = _DynamicManager.CreatePoolAnySlot(poolSize);
+            SyncDynamicCharge();
+            return handle;
         }
 
         /// <summary>
         /// Destroys the dynamic pool at the specified index.
-        /// Safe no-op if the slot is null.
+        /// Safe no-op if the slot is null. Pools deleted from a pressure callback are freed rather than recycled.
         /// </summary>
         inline void DeleteDynamicPool(size_t index) noexcept
         {
             _DynamicManager.DeletePool(index);
+            if (_Budget.InPressureCallback())
+                _DynamicManager.TrimRecycled(0);
+            SyncDynamicCharge();
         }
 
         /// <summary>
         /// Returns a reference to the dynamic pool at the specified index.
         /// Asserts in debug if the slot is null or out of bounds.
         /// </summary>
-        [[nodiscard]] inline MEMORY_POOL& GetDynamicPool(size_t index) noexcept
+        [[nodiscard]] inline POOL& GetDynamicPool(size_t index) noexcept
         {
             return _DynamicManager.GetPool(index);
         }
 
+        /// <summary>
+        /// Returns a generational handle to the dynamic pool at the specified index.
+        /// Asserts in debug if the slot is null or out of bounds.
+        /// </summary>
+        [[nodiscard]] inline POOL_HANDLE GetDynamicPoolHandle(size_t index) const noexcept
+        {
+            return _DynamicManager.GetHandle(index);
+        }
+
+        /// <summary>
+        /// Returns the dynamic pool a handle refers to, or nullptr if it was deleted or swapped since.
+        /// </summary>
+        [[nodiscard]] inline POOL* TryGetDynamicPool(POOL_HANDLE handle) noexcept
+        {
+            return _DynamicManager.TryGetPool(handle);
+        }
+
         /// <summary>
         /// Checks whether a dynamic pool exists at the specified index.
         /// </summary>
@@ -164,6 +267,15 @@ class MEMORY_MANAGER
             _DynamicManager.ResetPool(index);
         }
 
+        /// <summary>
+        /// Calls func(index, pool) for every active dynamic pool in index order.
+        /// </summary>
+        template<typename FUNC>
+        inline void ForEachDynamicPool(FUNC&& func)
+        {
+            _DynamicManager.ForEachPool(static_cast<FUNC&&>(func));
+        }
+
         /// <summary>
         /// Resets all active dynamic pools.
         /// Silently skips null slots.
@@ -174,6 +286,55 @@ class MEMORY_MANAGER
             _DynamicManager.ResetAll();
         }
 
+        /// <summary>
+        /// Sets how many bytes of deleted dynamic pools are kept for reuse by CreateDynamicPool.
+        /// 0, the default, disables recycling.
+        /// </summary>
+        inline void SetDynamicRecycleBudget(size_t budgetInBytes) noexcept
+        {
+            _DynamicManager.SetRecycleBudget(budgetInBytes);
+            SyncDynamicCharge();
+        }
+
+        /// <summary>
+        /// Frees recycled dynamic pools until at most maxBytes remain cached.
+        /// </summary>
+        inline void TrimDynamicRecycled(size_t maxBytes = 0) noexcept
+        {
+            _DynamicManager.TrimRecycled(maxBytes);
+            SyncDynamicCharge();
+        }
+
+        // ----------------------------------------------------------------
+        //  Memory Budget
+        // ----------------------------------------------------------------
+
+        /// <summary>
+        /// Returns the budget every pool of this manager is charged to, for inspecting usage or for
+        /// sharing with growable pools, e.g. VIRTUAL_MEMORY_POOL pool(MemoryUnits::GBToBytes(64), MemoryUnits::MBToBytes(2), &manager.GetBudget()).
+        /// </summary>
+        [[nodiscard]] inline MEMORY_BUDGET& GetBudget() noexcept { return _Budget; }
+
+        /// <summary>
+        /// Caps the bytes held across all pools charged to the budget. Defaults to MEMORY_BUDGET::Unlimited.
+        /// Lowering the limit below current usage frees nothing; further growth fails until usage drops.
+        /// </summary>
+        inline void SetBudgetLimit(size_t limitInBytes) noexcept
+        {
+            _Budget.SetLimit(limitInBytes);
+        }
+
+        /// <summary>
+        /// Registers callback(context, usedBytes, limitBytes) to run when usage rises across thresholdBytes,
+        /// and whenever a charge would exceed the limit, e.g. to delete idle dynamic pools or call
+        /// ReleaseUnused on growable ones. Runs after the manager has trimmed its recycle cache.
+        /// </summary>
+        /// <returns>True if registered; false if the budget has no callback slots left.</returns>
+        inline bool AddPressureCallback(size_t thresholdBytes, MEMORY_BUDGET::PRESSURE_CALLBACK callback, void* context = nullptr) noexcept
+        {
+            return _Budget.AddPressureCallback(thresholdBytes, callback, context);
+        }
+
         // ----------------------------------------------------------------
         //  Bulk Operations
         // ----------------------------------------------------------------
@@ -203,7 +364,58 @@ class MEMORY_MANAGER
         /// </summary>
         [[nodiscard]] inline size_t GetActiveDynamicCount() const noexcept
         {
-            return _DynamicManager.GetActiveCount();
+            return _DynamicManager.ActivePoolCount();
+        }
+
+        /// <summary>
+        /// Captures the size, usage and statistics of every fixed and dynamic pool, with totals.
+        /// Statistics are zero unless MEMORYCPP_POOL_STATS is defined; sizes and usage are always filled in.
+        /// Costs one pass over the fixed pools and the active dynamic pools.
+        /// </summary>
+        [[nodiscard]] SNAPSHOT Snapshot() noexcept
+        {
+            SNAPSHOT snapshot;
+
+            for (size_t i = 0; i < FixedCount; ++i)
+                Accumulate(snapshot, snapshot.Fixed[i], _FixedManager.GetPool(i));
+
+            _DynamicManager.ForEachPool([&](size_t index, POOL& pool) { Accumulate(snapshot, snapshot.Dynamic[index], pool); });
+
+            snapshot.RecycledBytes = _DynamicManager.GetRecycledBytes();
+            snapshot.RecycledCount = _DynamicManager.GetRecycledCount();
+            snapshot.BudgetUsed = _Budget.GetUsed();
+            snapshot.BudgetLimit = _Budget.GetLimit();
+            return snapshot;
+        }
+
+    private:
+
+        static void Accumulate(SNAPSHOT& snapshot, POOL_SNAPSHOT& entry, const POOL& pool) noexcept
+        {
+            entry = POOL_SNAPSHOT::Of(pool);
+
+            ++snapshot.PoolCount;
+            snapshot.TotalSize += entry.Size;
+            snapshot.TotalBytesUsed += entry.BytesUsed;
+            snapshot.TotalMaxBytesUsed += entry.MaxBytesUsed;
+            snapshot.TotalStats += entry.Stats;
+        }
+
+        /// <summary>
+        /// Charges poolSize ahead of creating a dynamic pool; SyncDynamicCharge settles it afterwards.
+        /// A parked pool that will be reused is already charged, so nothing is reserved for it; reserving
+        /// anyway could fail near the limit and trim the very pool the create would have taken.
+        /// </summary>
+        [[nodiscard]] inline bool ReserveDynamic(size_t poolSize) noexcept
+        {
+            if (_DynamicManager.CanRecycle(poolSize))
+                return true;
+
+            if (!_Budget.TryCharge(poolSize))
+                return false;
+
+            _DynamicCharged += poolSize;
+            return true;
         }
 };
 
@@ -0,0 +1,126 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_numa.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_NUMA_H_GUARD
+#define __MEMORY_NUMA_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t, uintptr_t
+
+#if defined(__linux__)
+#include <sys/syscall.h>    // SYS_mbind, SYS_get_mempolicy, SYS_getcpu
+#include <unistd.h>         // syscall, sysconf
+#endif
+
+
+/// <summary>
+/// NUMA node queries and memory binding through raw Linux system calls, so no libnuma is needed.
+/// On kernels without NUMA support and on other platforms every function degrades to a single
+/// node 0: GetNodeCount returns 1, GetCurrentNode returns 0 and binding to node 0 succeeds as a no-op.
+/// Nodes above 63 are not supported.
+/// </summary>
+namespace MemoryNuma
+{
+    constexpr unsigned MaxNodes = 64;
+
+    namespace Detail
+    {
+        constexpr int PolicyBind = 2;                   // MPOL_BIND
+        constexpr unsigned MoveFlag = 1u << 1;          // MPOL_MF_MOVE
+        constexpr unsigned long MemsAllowed = 1ul << 2; // MPOL_F_MEMS_ALLOWED
+    }
+
+    /// <summary>
+    /// Returns the number of NUMA nodes this process may allocate from, counted up to the highest allowed node.
+    /// The result is computed once and cached.
+    /// </summary>
+    [[nodiscard]] inline unsigned GetNodeCount() noexcept
+    {
+#if defined(__linux__)
+        static const unsigned count = []() noexcept
+        {
+            int mode = 0;
+            uint64_t mask = 0;
+
+            if (::syscall(SYS_get_mempolicy, &mode, &mask, MaxNodes + 1, nullptr, Detail::MemsAllowed) != 0 || mask == 0)
+                return 1u;
+
+            return static_cast<unsigned>(64 - __builtin_clzll(mask));
+        }();
+
+        return count;
+#else
+        return 1;
+#endif
+    }
+
+    /// <summary>
+    /// Returns the NUMA node of the CPU the calling thread is running on.
+    /// The answer can be stale as soon as it returns if the thread migrates; pin threads that need it to stay true.
+    /// Costs one system call, so cache the result per thread or task rather than calling it per allocation.
+    /// </summary>
+    [[nodiscard]] inline unsigned GetCurrentNode() noexcept
+    {
+#if defined(__linux__)
+        unsigned cpu = 0;
+        unsigned node = 0;
+
+        if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+            return 0;
+
+        return node;
+#else
+        return 0;
+#endif
+    }
+
+    /// <summary>
+    /// Binds the whole pages inside [head, head + sizeInBytes) to a NUMA node. Pages not yet touched
+    /// will be faulted in on that node; pages already touched are migrated. Pages only partly inside
+    /// the range are left alone since they may hold unrelated data.
+    /// </summary>
+    /// <param name="head">The start of the range.</param>
+    /// <param name="sizeInBytes">The size of the range in bytes.</param>
+    /// <param name="node">The target node.</param>
+    /// <returns>True if the range was bound, or node is 0 on a machine without NUMA support; otherwise false.</returns>
+    inline bool BindToNode(void* head, size_t sizeInBytes, unsigned node) noexcept
+    {
+        if (node >= GetNodeCount())
+            return false;
+
+#if defined(__linux__)
+        const uintptr_t pageSize = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const uintptr_t start = (reinterpret_cast<uintptr_t>(head) + pageSize - 1) & ~(pageSize - 1);
+        const uintptr_t end = (reinterpret_cast<uintptr_t>(head) + sizeInBytes) & ~(pageSize - 1);
+
+        if (end <= start)
+            return true;
+
+        const uint64_t mask = uint64_t(1) << node;
+
+        if (::syscall(SYS_mbind, start, end - start, Detail::PolicyBind, &mask, MaxNodes + 1, Detail::MoveFlag) == 0)
+            return true;
+
+        return GetNodeCount() == 1;                                 // Kernels built without NUMA reject mbind; there is nowhere else to go
+#else
+        (void)head;
+        (void)sizeInBytes;
+        return true;
+#endif
+    }
+}
+
+#endif
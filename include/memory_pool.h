@@ -19,8 +19,36 @@
 #define __MEMORY_POOL_H_GUARD
 
 #include <cstddef>              // size_t
+#include <cstdint>              // uintptr_t
+#include <new>                  // placement new
+#include <cstring>              // memcpy
 #include "memory_block.h"   
 #include "memory_slice.h"
+#include "memory_snapshot.h"
+#include "memory_prefault.h"
+#include "memory_debug.h"
+#include "memory_align.h"
+#include "memory_stats.h"
+
+
+/// <summary>
+/// Detects blocks that commit memory lazily by providing EnsureCommitted(size_t endOffset).
+/// BASIC_MEMORY_POOL only calls the hook for such blocks, so fully committed blocks pay nothing.
+/// </summary>
+template<typename BLOCK, typename = void>
+struct BLOCK_COMMIT_TRAITS
+{
+    static constexpr bool IsLazy = false;
+};
+
+template<typename BLOCK>
+BLOCK& BLOCK_COMMIT_TRAITS_REF() noexcept;     // Declared only; names a BLOCK lvalue in unevaluated contexts
+
+template<typename BLOCK>
+struct BLOCK_COMMIT_TRAITS<BLOCK, decltype(void(BLOCK_COMMIT_TRAITS_REF<BLOCK>().EnsureCommitted(size_t(0))))>
+{
+    static constexpr bool IsLazy = true;
+};
 
 
 /// <summary>
@@ -29,29 +57,186 @@
 /// call Reset() to free everything at once, which makes this ideal for temporary or
 /// per-frame allocations where the lifetime of all objects is known upfront.
 /// All allocations are 8-byte aligned internally.
+/// The backing block type is a template parameter so the same allocator can run over heap memory
+/// (MEMORY_POOL), a memory-mapped file (PERSISTENT_MEMORY_POOL) or any other block exposing
+/// GetHead() and GetSize(). Constructor arguments are forwarded to the block.
+/// Blocks that reserve more than they commit (VIRTUAL_MEMORY_BLOCK) also expose EnsureCommitted,
+/// which the pool calls before handing out memory past the committed end.
+/// Debug builds with MEMORYCPP_POOL_DEBUG add canaries after each slice, and AddressSanitizer builds
+/// poison memory on Reset; see memory_debug.h. Builds with MEMORYCPP_POOL_STATS count allocations,
+/// failures, padding and resets, and builds with MEMORYCPP_POOL_HISTORY keep per-epoch usage and a
+/// request size histogram; see memory_stats.h.
 /// Not copyable. Not thread-safe.
 /// </summary>
-class MEMORY_POOL
+/// <typeparam name="BLOCK">The block type that owns the pool's memory.</typeparam>
+template<typename BLOCK>
+class BASIC_MEMORY_POOL
 {
-    private:
-        MEMORY_BLOCK _Block;            // Allocated Memory Block
+    protected:
+        BLOCK _Block;                   // Allocated Memory Block
         size_t _NextOffset = 0;         // Current allocation position
         size_t _MaxBytesUsed = 0;       // Maxiumum Allocation over lifetime
+        size_t _BaseAlignment = 0;      // Largest power of two dividing the block head; aligned takes up to this need no address math
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+        size_t _LastCanary = 0;         // Offset of the newest canary record plus one; 0 when there are none
+#endif
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+        POOL_STATS _Stats;
+#endif
+#if defined(MEMORYCPP_POOL_HISTORY_ENABLED)
+        POOL_HISTORY _History;
+#endif
 
+        /// <summary>
+        /// Returns how much of the block is backed by memory: the committed prefix for lazy blocks, all of it otherwise.
+        /// Poisoning stops here, so a large reservation never costs shadow memory for pages it has not committed.
+        /// </summary>
+        [[nodiscard]] inline size_t MappedSize() const noexcept
+        {
+            if constexpr (BLOCK_COMMIT_TRAITS<BLOCK>::IsLazy)
+                return _Block.GetCommittedSize();
+            else
+                return _Block.GetSize();
+        }
+
+        /// <summary>
+        /// Makes [0, endOffset) of the block usable. Compiles to nothing for fully committed blocks.
+        /// </summary>
+        inline bool CommitThrough(size_t endOffset) noexcept
+        {
+            if constexpr (BLOCK_COMMIT_TRAITS<BLOCK>::IsLazy)
+            {
+#if defined(MEMORYCPP_ASAN)
+                const size_t committed = _Block.GetCommittedSize();
+                if (!_Block.EnsureCommitted(endOffset))
+                    return false;
+
+                PoisonRange(committed, _Block.GetCommittedSize());             // Newly committed pages start out unallocated
+                return true;
+#else
+                return _Block.EnsureCommitted(endOffset);
+#endif
+            }
+            else
+                return (void)endOffset, true;
+        }
+
+        /// <summary>
+        /// Marks [from, to) of the block as inaccessible or accessible under AddressSanitizer. No-ops otherwise.
+        /// Pools that move _NextOffset directly (restores, clones) unpoison the range they adopt.
+        /// </summary>
+        inline void PoisonRange(size_t from, size_t to) noexcept
+        {
+            if (to > from && _Block.GetHead() != nullptr)
+                MemoryDebug::Poison(static_cast<char*>(_Block.GetHead()) + from, to - from);
+        }
+
+        inline void UnpoisonRange(size_t from, size_t to) noexcept
+        {
+            if (to > from && _Block.GetHead() != nullptr)
+                MemoryDebug::Unpoison(static_cast<char*>(_Block.GetHead()) + from, to - from);
+        }
 
     public:
 
-        MEMORY_POOL() = default;
-        MEMORY_POOL(size_t sizeInBytes) : _Block(sizeInBytes) { }
+        template<typename... Args>
+        BASIC_MEMORY_POOL(Args&&... args) : _Block(static_cast<Args&&>(args)...), _BaseAlignment(MemoryAlign::AlignmentOf(_Block.GetHead()))
+        {
+            PoisonRange(0, MappedSize());                                       // Nothing is allocated yet, so an overrun past the last slice faults under ASan
+        }
 
-        MEMORY_POOL(const MEMORY_POOL&) = delete;             // Prevent copies
-        MEMORY_POOL& operator=(const MEMORY_POOL&) = delete;  // Prevent copies
+        BASIC_MEMORY_POOL(const BASIC_MEMORY_POOL&) = delete;             // Prevent copies
+        BASIC_MEMORY_POOL& operator=(const BASIC_MEMORY_POOL&) = delete;  // Prevent copies
 
-        ~MEMORY_POOL() = default;
+        ~BASIC_MEMORY_POOL()
+        {
+            UnpoisonRange(0, MappedSize());                                     // Leave no stale poison on memory the block hands back
+        }
 
         [[nodiscard]] size_t Size() const noexcept { return _Block.GetSize(); }
         [[nodiscard]] size_t GetMaxBytesUsed() const noexcept { return _MaxBytesUsed; }
         [[nodiscard]] size_t BytesUsed() const noexcept { return _NextOffset; }
+        [[nodiscard]] void* GetBase() const noexcept { return _Block.GetHead(); }
+        [[nodiscard]] size_t GetBaseAlignment() const noexcept { return _BaseAlignment; }
+
+        /// <summary>
+        /// Clears the lifetime high-water mark, e.g. when a pool is handed to a new owner.
+        /// </summary>
+        inline void ResetMaxBytesUsed() noexcept { _MaxBytesUsed = 0; }
+
+        /// <summary>
+        /// Returns the pool's counters, all zero unless MEMORYCPP_POOL_STATS is defined.
+        /// </summary>
+        [[nodiscard]] inline POOL_STATS GetStats() const noexcept
+        {
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+            return _Stats;
+#else
+            return POOL_STATS();
+#endif
+        }
+
+        /// <summary>
+        /// Returns the pool's epoch usage ring and request size histogram, empty unless MEMORYCPP_POOL_HISTORY is defined.
+        /// </summary>
+        [[nodiscard]] inline const POOL_HISTORY& GetHistory() const noexcept
+        {
+#if defined(MEMORYCPP_POOL_HISTORY_ENABLED)
+            return _History;
+#else
+            static constexpr POOL_HISTORY empty{};
+            return empty;
+#endif
+        }
+
+        /// <summary>
+        /// Clears the pool's counters and history, e.g. at the start of a measurement window.
+        /// </summary>
+        inline void ResetStats() noexcept
+        {
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+            _Stats = POOL_STATS();
+#endif
+#if defined(MEMORYCPP_POOL_HISTORY_ENABLED)
+            _History = POOL_HISTORY();
+#endif
+        }
+
+        /// <summary>
+        /// Binds the pool's block to a NUMA node. Call before the first take so pages fault in on that node.
+        /// Only available for block types that provide BindToNode, such as MEMORY_BLOCK.
+        /// </summary>
+        /// <param name="node">The target NUMA node.</param>
+        /// <returns>True if the block was bound, or node is 0 on a single-node machine; otherwise false.</returns>
+        inline bool BindToNode(unsigned node) noexcept { return _Block.BindToNode(node); }
+
+        /// <summary>
+        /// Faults in the pages backing [offset, offset + sizeInBytes) of the block so that first use of
+        /// that range does not page fault. The range is clamped to the block; contents are unchanged.
+        /// On a lazily committed block the range is committed first.
+        /// Typically called on the whole pool at load time, or on the next region ahead of a latency-sensitive phase.
+        /// </summary>
+        /// <param name="offset">The byte offset from the start of the block.</param>
+        /// <param name="sizeInBytes">The number of bytes to prefault.</param>
+        inline void Prefault(size_t offset, size_t sizeInBytes) noexcept
+        {
+            const size_t blockSize = _Block.GetSize();
+            if (offset >= blockSize)
+                return;
+
+            if (sizeInBytes > blockSize - offset)
+                sizeInBytes = blockSize - offset;
+
+            if (!CommitThrough(offset + sizeInBytes))
+                return;
+
+            MemoryPrefault::Populate(static_cast<char*>(_Block.GetHead()) + offset, sizeInBytes);
+        }
+
+        /// <summary>
+        /// Faults in every page of the block.
+        /// </summary>
+        inline void Prefault() noexcept { Prefault(0, _Block.GetSize()); }
 
         /// <summary>
         /// Determines whether the given pointer belongs to this pool's memory block.
@@ -80,17 +265,33 @@ class MEMORY_POOL
         {
             assert(sizeInBytes > 0 && "TakeSlice: cannot request 0 bytes");     
 
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            return TakeAlignedSlice(sizeInBytes, 8);                            // Canaries are written in one place
+#else
             const size_t alignedReq = (sizeInBytes + 7) & ~7;                   // Round up the request to 8-byte alignment to keep the next slice aligned
 
-            if (_NextOffset + alignedReq > _Block.GetSize())                    // Verify we have enough room remaining in the block
+            if (_NextOffset + alignedReq > _Block.GetSize() || !CommitThrough(_NextOffset + alignedReq))    // Room in the block, committed if lazy
             {
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+                ++_Stats.FailureCount;
+#endif
                 return MEMORY_SLICE(nullptr, 0);
             }
 
             void* ptr = static_cast<char*>(_Block.GetHead()) + _NextOffset;     // Calculate the address at the current offset
             _NextOffset += alignedReq;                                          // Advance the offset for the next call
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+            ++_Stats.AllocationCount;
+            _Stats.PaddingBytes += alignedReq - sizeInBytes;
+#endif
+#if defined(MEMORYCPP_POOL_HISTORY_ENABLED)
+            _History.RecordSize(sizeInBytes);
+#endif
+
+            MemoryDebug::Unpoison(ptr, sizeInBytes);
 
             return MEMORY_SLICE(ptr, sizeInBytes);
+#endif
         }
 
         /// <summary>
@@ -100,6 +301,8 @@ class MEMORY_POOL
         /// requirement. The internal offset is always advanced by a multiple of 8 bytes to ensure
         /// subsequent TakeSlice calls remain correctly aligned regardless of the requested alignment
         /// or how much padding was required.
+        /// Alignments up to the block's base alignment (GetBaseAlignment) are resolved from the offset alone,
+        /// and those of 8 or less need no padding at all.
         /// </summary>
         /// <param name="sizeInBytes">The number of bytes requested.</param>
         /// <param name="alignment">The required alignment in bytes. Must be a non-zero power of two.</param>
@@ -113,19 +316,55 @@ class MEMORY_POOL
             assert(sizeInBytes > 0 && "TakeAlignedSlice: cannot request 0 bytes");
             assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "TakeAlignedSlice: alignment must be a non-zero power of two");
 
-            uintptr_t raw = reinterpret_cast<uintptr_t>(_Block.GetHead()) + _NextOffset;
-            uintptr_t aligned = (raw + (alignment - 1)) & ~(alignment - 1);
-            size_t    padding = aligned - raw;                                          // Bytes skipped to reach requested alignment
+            size_t padding = 0;                                                         // Bytes skipped to reach requested alignment
+
+            if (alignment > _BaseAlignment)                                             // Head is less aligned than requested; pad from the address
+            {
+                const uintptr_t raw = reinterpret_cast<uintptr_t>(_Block.GetHead()) + _NextOffset;
+                padding = static_cast<size_t>(((raw + (alignment - 1)) & ~(alignment - 1)) - raw);
+            }
+            else if (alignment > 8)                                                     // Offsets are multiples of 8, so smaller alignments are already met
+            {
+                padding = (0 - _NextOffset) & (alignment - 1);
+            }
 
             size_t totalAdvance = padding + sizeInBytes;                                // Total bytes consumed
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            totalAdvance += sizeof(MemoryDebug::CANARY);                                // Canary record directly after the slice
+#endif
             totalAdvance = (totalAdvance + 7) & ~7;                              // Round total advance up to 8-byte alignment
 
-            if (_NextOffset + totalAdvance > _Block.GetSize())
+            if (_NextOffset + totalAdvance > _Block.GetSize() || !CommitThrough(_NextOffset + totalAdvance))
+            {
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+                ++_Stats.FailureCount;
+#endif
                 return MEMORY_SLICE(nullptr, 0);
+            }
 
-            _NextOffset += totalAdvance;
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            const size_t canaryOffset = _NextOffset + padding + sizeInBytes;
+            const MemoryDebug::CANARY canary = { MemoryDebug::CANARY::ExpectedPattern, _LastCanary };
+            char* record = static_cast<char*>(_Block.GetHead()) + canaryOffset;
+
+            MemoryDebug::Unpoison(record, sizeof(canary));
+            memcpy(record, &canary, sizeof(canary));                                    // Unaligned by design, so even a 1-byte overrun lands on it
+            MemoryDebug::Poison(record, sizeof(canary));
+            _LastCanary = canaryOffset + 1;
+#endif
 
-            return MEMORY_SLICE(reinterpret_cast<void*>(aligned), sizeInBytes);
+            char* aligned = static_cast<char*>(_Block.GetHead()) + _NextOffset + padding;
+            _NextOffset += totalAdvance;
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+            ++_Stats.AllocationCount;
+            _Stats.PaddingBytes += totalAdvance - sizeInBytes;                          // Includes the canary record in debug builds
+#endif
+#if defined(MEMORYCPP_POOL_HISTORY_ENABLED)
+            _History.RecordSize(sizeInBytes);
+#endif
+
+            MemoryDebug::Unpoison(aligned, sizeInBytes);
+            return MEMORY_SLICE(aligned, sizeInBytes);
         }
 
         /// <summary>
@@ -187,14 +426,149 @@ class MEMORY_POOL
         /// </summary>
         inline void Reset() noexcept
         {
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            CheckCanaries();
+            _LastCanary = 0;
+#endif
+            PoisonRange(0, MappedSize());                                       // Stale pointers into the old contents now fault under ASan
+#if defined(MEMORYCPP_POOL_STATS_ENABLED)
+            ++_Stats.ResetCount;
+#endif
+#if defined(MEMORYCPP_POOL_HISTORY_ENABLED)
+            _History.RecordEpoch(_NextOffset);
+#endif
+
             if (_NextOffset > _MaxBytesUsed)
                 _MaxBytesUsed = _NextOffset;
 
             _NextOffset = 0;
         }
 
+        /// <summary>
+        /// Verifies the canary after every slice taken since the last Reset, asserting on the first one
+        /// that was overwritten. Called automatically by Reset. Always returns true unless
+        /// MEMORYCPP_POOL_DEBUG is enabled in a debug build.
+        /// </summary>
+        /// <returns>True if every canary is intact; otherwise false.</returns>
+        bool CheckCanaries() noexcept
+        {
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            size_t link = _LastCanary;
+
+            while (link != 0)
+            {
+                const size_t offset = link - 1;
+                char* record = static_cast<char*>(_Block.GetHead()) + offset;
+                MemoryDebug::CANARY canary;
+
+                MemoryDebug::Unpoison(record, sizeof(canary));
+                memcpy(&canary, record, sizeof(canary));
+                MemoryDebug::Poison(record, sizeof(canary));
+
+                if (canary.Pattern != MemoryDebug::CANARY::ExpectedPattern || canary.Previous >= link)
+                {
+                    assert(false && "CheckCanaries: canary overwritten, the slice before this offset was overrun!");
+                    return false;
+                }
+
+                link = static_cast<size_t>(canary.Previous);
+            }
+#endif
+            return true;
+        }
+
+        /// <summary>
+        /// Returns committed memory above the current allocation position to the system.
+        /// Only available for block types that provide Decommit, such as VIRTUAL_MEMORY_BLOCK;
+        /// typically called after Reset once a usage spike has passed.
+        /// </summary>
+        inline void ReleaseUnused() noexcept
+        {
+            UnpoisonRange(_NextOffset, MappedSize());                           // Pages handed back keep no stale poison
+            _Block.Decommit(_NextOffset);
+            PoisonRange(_NextOffset, MappedSize());                             // The page holding _NextOffset stays committed
+        }
+
+        /// <summary>
+        /// Writes the used region [0, BytesUsed) and the pool's metadata to a snapshot file.
+        /// The file is written beside path and renamed into place, so a failed save never clobbers
+        /// the previous snapshot. Bulk data bypasses the page cache with O_DIRECT when the arena is
+        /// 4 KB aligned and the filesystem allows it; otherwise it is written in large batches.
+        /// Pointers stored in the arena are saved verbatim; use REL_PTR for links that must survive a restore.
+        /// Under AddressSanitizer the used region is unpoisoned for the write and its poisoning put back
+        /// afterwards; only the shadow state changes, never the pool, so this is safe on a const pool.
+        /// </summary>
+        /// <param name="path">The snapshot file to write.</param>
+        /// <param name="durable">True to block until the snapshot is on disk (POSIX; see memory_snapshot.h for other platforms). Defaults to true.</param>
+        /// <returns>True if the snapshot was written; otherwise false.</returns>
+        bool SaveSnapshot(const char* path, bool durable = true) const noexcept
+        {
+            if (_Block.GetHead() == nullptr)
+                return false;
+
+            const size_t maxBytesUsed = _NextOffset > _MaxBytesUsed ? _NextOffset : _MaxBytesUsed;
+            const MemoryDebug::UNPOISON_SCOPE unpoisoned(_Block.GetHead(), _NextOffset);    // Padding and canaries are written out verbatim
+            return MemorySnapshot::Save(path, _Block.GetHead(), _NextOffset, maxBytesUsed, _Block.GetSize(), durable);
+        }
+
+        /// <summary>
+        /// Restores a snapshot written by SaveSnapshot into this pool, replacing its contents and
+        /// allocation position. The pool may be a different size from the one that was saved as long
+        /// as the saved bytes fit. A file that fails validation leaves the pool untouched; a read error
+        /// part way through keeps the allocation position but leaves the contents unspecified.
+        /// Does not call destructors on any allocated objects.
+        /// </summary>
+        /// <param name="path">The snapshot file to read.</param>
+        /// <returns>True if the snapshot was restored; false if it is missing, invalid, truncated or larger than the pool.</returns>
+        bool LoadSnapshot(const char* path) noexcept
+        {
+            if (_Block.GetHead() == nullptr)
+                return false;
+
+            size_t bytesUsed = 0;
+            size_t maxBytesUsed = 0;
+
+            if constexpr (BLOCK_COMMIT_TRAITS<BLOCK>::IsLazy)
+            {
+                if (!MemorySnapshot::PeekBytesUsed(path, bytesUsed) || bytesUsed > _Block.GetSize() || !CommitThrough(bytesUsed))
+                    return false;
+            }
+
+            UnpoisonRange(0, bytesUsed ? bytesUsed : _Block.GetSize());
+
+            if (!MemorySnapshot::Load(path, _Block.GetHead(), _Block.GetSize(), bytesUsed, maxBytesUsed))
+            {
+                PoisonRange(_NextOffset, MappedSize());
+                return false;
+            }
+
+            _NextOffset = bytesUsed;
+            if (maxBytesUsed > _MaxBytesUsed)
+                _MaxBytesUsed = maxBytesUsed;
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+            _LastCanary = 0;                                                    // The restored slices' records are not tracked
+#endif
+            PoisonRange(_NextOffset, MappedSize());                             // Everything past the restored position is unallocated
+
+            return true;
+        }
+
 
 };
 
 
+/// <summary>
+/// The standard heap-backed pool.
+/// </summary>
+using MEMORY_POOL = BASIC_MEMORY_POOL<MEMORY_BLOCK>;
+
+/// <summary>
+/// A pool whose block comes from a memory source other than the heap, e.g.
+/// SOURCED_MEMORY_POOL<MMAP_MEMORY_SOURCE> or SOURCED_MEMORY_POOL<STATIC_MEMORY_SOURCE<1 << 20>>.
+/// The take path is identical to MEMORY_POOL's; see memory_source.h.
+/// </summary>
+template<typename SOURCE>
+using SOURCED_MEMORY_POOL = BASIC_MEMORY_POOL<BASIC_MEMORY_BLOCK<SOURCE>>;
+
+
 #endif
\ No newline at end of file
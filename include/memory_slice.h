@@ -43,7 +43,7 @@ class MEMORY_SLICE
         /// <param name="sizeInBytes">The size of the memory region in bytes.</param>
         explicit MEMORY_SLICE(void* head, size_t sizeInBytes) : _Head(head), _SizeInBytes(sizeInBytes)
         {
-            assert(sizeInBytes > 0 && "MEMORY_SLICE: size cannot be zero!");
+            assert((head == nullptr || sizeInBytes > 0) && "MEMORY_SLICE: size cannot be zero!");
         }
 
         ~MEMORY_SLICE() = default;
@@ -0,0 +1,373 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_snapshot.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_SNAPSHOT_H_GUARD
+#define __MEMORY_SNAPSHOT_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t, uintptr_t
+#include <cstring>      // memcpy, memset, strlen, strrchr
+#include <cstdio>       // FILE, fopen, fwrite, fread, rename
+
+#if defined(__unix__) || defined(__APPLE__)
+#define __MEMORY_SNAPSHOT_POSIX 1
+#include <fcntl.h>      // open, O_DIRECT
+#include <unistd.h>     // pwrite, pread, close, fdatasync, fsync
+#include <errno.h>      // errno, EINTR
+#elif defined(_WIN32)
+#include <io.h>         // _commit, _fileno
+#endif
+
+
+/// <summary>
+/// Bulk save and restore of an arena's used region, the backing implementation for
+/// MEMORY_POOL::SaveSnapshot and MEMORY_POOL::LoadSnapshot.
+///
+/// File layout: a 4 KB header block followed by the raw bytes of [0, BytesUsed). Keeping the data
+/// block aligned lets the POSIX path use O_DIRECT whenever the arena itself is 4 KB aligned, so the
+/// copy bypasses the page cache entirely; otherwise it falls back to large 8 MB pwrite/pread batches.
+/// Saves go to "path.tmp" and are renamed over path only once complete, so an interrupted
+/// checkpoint never replaces the previous good one.
+/// A durable save syncs the file, and on POSIX also the directory holding it, so the rename survives
+/// a crash too. On Windows the file's data is committed but the rename itself is not flushed; other
+/// platforms only flush the C library's buffers, so durability is not guaranteed there.
+/// </summary>
+namespace MemorySnapshot
+{
+    struct HEADER
+    {
+        static constexpr uint64_t ExpectedMagic = 0x50414E534D454D43ull;     // "CMEMSNAP"
+        static constexpr uint32_t CurrentVersion = 1;
+
+        uint64_t Magic;
+        uint32_t Version;
+        uint32_t HeaderBytes;
+        uint64_t BytesUsed;
+        uint64_t MaxBytesUsed;
+        uint64_t Capacity;
+    };
+
+    constexpr size_t HeaderBytes = 4096;                // Also the O_DIRECT alignment unit
+    constexpr size_t BatchBytes = size_t(8) << 20;      // Bytes per buffered system call
+    constexpr size_t MaxPathLength = 4096;
+
+    namespace Detail
+    {
+        [[nodiscard]] inline bool IsDirectAligned(const void* ptr) noexcept
+        {
+            return (reinterpret_cast<uintptr_t>(ptr) & (HeaderBytes - 1)) == 0;
+        }
+
+#if defined(__MEMORY_SNAPSHOT_POSIX)
+
+        /// <summary>
+        /// Opens path with O_DIRECT added to flags where the platform supports it.
+        /// Returns -1 if the filesystem rejects direct I/O, letting the caller fall back to buffered I/O.
+        /// </summary>
+        [[nodiscard]] inline int OpenDirect(const char* path, int flags) noexcept
+        {
+#if defined(O_DIRECT)
+            return ::open(path, flags | O_DIRECT | O_CLOEXEC, 0644);
+#else
+            (void)path;
+            (void)flags;
+            return -1;
+#endif
+        }
+
+        /// <summary>
+        /// Writes size bytes at offset, looping over short writes and EINTR.
+        /// </summary>
+        [[nodiscard]] inline bool WriteFully(int fd, const void* data, size_t size, size_t offset) noexcept
+        {
+            const unsigned char* p = static_cast<const unsigned char*>(data);
+            while (size > 0)
+            {
+                const size_t batch = size < BatchBytes ? size : BatchBytes;
+                const ssize_t written = ::pwrite(fd, p, batch, static_cast<off_t>(offset));
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+                if (written == 0)
+                    return false;
+
+                p += written;
+                offset += static_cast<size_t>(written);
+                size -= static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Flushes the directory containing path, making a file created or renamed in it durable.
+        /// </summary>
+        [[nodiscard]] inline bool SyncParentDirectory(const char* path) noexcept
+        {
+            const char* slash = std::strrchr(path, '/');
+            char directory[MaxPathLength];
+
+            if (slash == nullptr)
+            {
+                std::memcpy(directory, ".", 2);
+            }
+            else
+            {
+                const size_t length = slash == path ? 1 : static_cast<size_t>(slash - path);     // Keep "/" for files at the root
+                std::memcpy(directory, path, length);
+                directory[length] = '\0';
+            }
+
+            const int fd = ::open(directory, O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                return false;
+
+            const bool ok = ::fsync(fd) == 0;
+            ::close(fd);
+            return ok;
+        }
+
+        /// <summary>
+        /// Reads size bytes at offset, looping over short reads and EINTR. Fails on a premature end of file.
+        /// </summary>
+        [[nodiscard]] inline bool ReadFully(int fd, void* data, size_t size, size_t offset) noexcept
+        {
+            unsigned char* p = static_cast<unsigned char*>(data);
+            while (size > 0)
+            {
+                const size_t batch = size < BatchBytes ? size : BatchBytes;
+                const ssize_t got = ::pread(fd, p, batch, static_cast<off_t>(offset));
+                if (got < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+                if (got == 0)
+                    return false;
+
+                p += got;
+                offset += static_cast<size_t>(got);
+                size -= static_cast<size_t>(got);
+            }
+            return true;
+        }
+
+#endif
+    }
+
+    /// <summary>
+    /// Writes a snapshot of an arena's used region to path, replacing any existing file atomically.
+    /// </summary>
+    /// <param name="path">The destination file.</param>
+    /// <param name="data">The start of the arena.</param>
+    /// <param name="bytesUsed">The number of bytes in use, written verbatim.</param>
+    /// <param name="maxBytesUsed">The arena's high-water mark, recorded as metadata.</param>
+    /// <param name="capacity">The arena's size, recorded as metadata.</param>
+    /// <param name="durable">True to flush the file (and on POSIX its directory entry) to disk before returning.</param>
+    /// <returns>True if the snapshot was written and renamed into place; false on any I/O error.</returns>
+    [[nodiscard]] inline bool Save(const char* path, const void* data, size_t bytesUsed, size_t maxBytesUsed, size_t capacity, bool durable) noexcept
+    {
+        const size_t pathLength = std::strlen(path);
+        if (pathLength + 5 > MaxPathLength)
+            return false;
+
+        char tempPath[MaxPathLength];
+        std::memcpy(tempPath, path, pathLength);
+        std::memcpy(tempPath + pathLength, ".tmp", 5);
+
+        alignas(HeaderBytes) unsigned char headerBlock[HeaderBytes];
+        std::memset(headerBlock, 0, HeaderBytes);
+
+        HEADER header;
+        header.Magic = HEADER::ExpectedMagic;
+        header.Version = HEADER::CurrentVersion;
+        header.HeaderBytes = static_cast<uint32_t>(HeaderBytes);
+        header.BytesUsed = bytesUsed;
+        header.MaxBytesUsed = maxBytesUsed;
+        header.Capacity = capacity;
+        std::memcpy(headerBlock, &header, sizeof(header));
+
+#if defined(__MEMORY_SNAPSHOT_POSIX)
+        using namespace Detail;
+
+        const size_t directBytes = IsDirectAligned(data) ? (bytesUsed & ~(HeaderBytes - 1)) : 0;
+        const int directFd = directBytes ? OpenDirect(tempPath, O_WRONLY | O_CREAT | O_TRUNC) : -1;
+        const int fd = ::open(tempPath, O_WRONLY | O_CREAT | (directFd >= 0 ? 0 : O_TRUNC) | O_CLOEXEC, 0644);
+
+        bool ok = fd >= 0;
+
+        if (ok && directFd >= 0)                                            // Aligned bulk straight from the arena, bypassing the page cache
+        {
+            ok = WriteFully(directFd, headerBlock, HeaderBytes, 0) &&
+                 WriteFully(directFd, data, directBytes, HeaderBytes);
+        }
+        else if (ok)
+        {
+            ok = WriteFully(fd, headerBlock, HeaderBytes, 0);
+        }
+
+        const size_t bufferedStart = directFd >= 0 ? directBytes : 0;       // Unaligned tail, or everything without O_DIRECT
+        if (ok)
+            ok = WriteFully(fd, static_cast<const unsigned char*>(data) + bufferedStart, bytesUsed - bufferedStart, HeaderBytes + bufferedStart);
+
+        if (ok && durable)
+            ok = ::fsync(fd) == 0;
+
+        if (directFd >= 0)
+            ::close(directFd);
+        if (fd >= 0)
+            ::close(fd);
+#else
+        FILE* file = std::fopen(tempPath, "wb");
+        bool ok = file != nullptr;
+
+        if (ok)
+            ok = std::fwrite(headerBlock, 1, HeaderBytes, file) == HeaderBytes &&
+                 std::fwrite(data, 1, bytesUsed, file) == bytesUsed;
+
+        if (ok && durable)
+        {
+            ok = std::fflush(file) == 0;
+#if defined(_WIN32)
+            if (ok)
+                ok = ::_commit(::_fileno(file)) == 0;                          // fflush only reaches the OS cache
+#endif
+        }
+
+        if (file)
+            std::fclose(file);
+#endif
+
+        if (!ok)
+        {
+            std::remove(tempPath);
+            return false;
+        }
+
+        if (std::rename(tempPath, path) != 0)
+            return false;
+
+#if defined(__MEMORY_SNAPSHOT_POSIX)
+        if (durable)
+            return Detail::SyncParentDirectory(path);
+#endif
+        return true;
+    }
+
+    /// <summary>
+    /// Reads just the used byte count from a snapshot's header, so a caller can prepare room before Load.
+    /// </summary>
+    /// <param name="path">The snapshot file.</param>
+    /// <param name="bytesUsed">Receives the used byte count recorded in the header.</param>
+    /// <returns>True if the file has a valid header; otherwise false.</returns>
+    [[nodiscard]] inline bool PeekBytesUsed(const char* path, size_t& bytesUsed) noexcept
+    {
+        FILE* file = std::fopen(path, "rb");
+        if (!file)
+            return false;
+
+        HEADER header;
+        const bool ok = std::fread(&header, 1, sizeof(header), file) == sizeof(header) &&
+                        header.Magic == HEADER::ExpectedMagic && header.Version == HEADER::CurrentVersion;
+
+        std::fclose(file);
+
+        if (ok)
+            bytesUsed = static_cast<size_t>(header.BytesUsed);
+        return ok;
+    }
+
+    /// <summary>
+    /// Reads a snapshot written by Save into an arena.
+    /// The arena is only modified once the header has been validated and the data is known to fit.
+    /// </summary>
+    /// <param name="path">The snapshot file.</param>
+    /// <param name="data">The start of the destination arena.</param>
+    /// <param name="capacity">The size of the destination arena in bytes.</param>
+    /// <param name="bytesUsed">Receives the restored used byte count.</param>
+    /// <param name="maxBytesUsed">Receives the recorded high-water mark.</param>
+    /// <returns>True if the snapshot was restored; false if the file is missing, invalid, too large or truncated.</returns>
+    [[nodiscard]] inline bool Load(const char* path, void* data, size_t capacity, size_t& bytesUsed, size_t& maxBytesUsed) noexcept
+    {
+        alignas(HeaderBytes) unsigned char headerBlock[HeaderBytes];
+        HEADER header;
+
+#if defined(__MEMORY_SNAPSHOT_POSIX)
+        using namespace Detail;
+
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        bool ok = ReadFully(fd, headerBlock, HeaderBytes, 0);
+        std::memcpy(&header, headerBlock, sizeof(header));
+
+        ok = ok && header.Magic == HEADER::ExpectedMagic && header.Version == HEADER::CurrentVersion &&
+                   header.HeaderBytes == HeaderBytes && header.BytesUsed <= capacity;
+
+        size_t directBytes = 0;
+        if (ok && IsDirectAligned(data))
+        {
+            directBytes = static_cast<size_t>(header.BytesUsed) & ~(HeaderBytes - 1);
+            const int directFd = directBytes ? OpenDirect(path, O_RDONLY) : -1;
+
+            if (directFd >= 0)
+            {
+                ok = ReadFully(directFd, data, directBytes, HeaderBytes);
+                ::close(directFd);
+            }
+            else
+            {
+                directBytes = 0;
+            }
+        }
+
+        if (ok)
+            ok = ReadFully(fd, static_cast<unsigned char*>(data) + directBytes, static_cast<size_t>(header.BytesUsed) - directBytes, HeaderBytes + directBytes);
+
+        ::close(fd);
+#else
+        FILE* file = std::fopen(path, "rb");
+        if (!file)
+            return false;
+
+        bool ok = std::fread(headerBlock, 1, HeaderBytes, file) == HeaderBytes;
+        std::memcpy(&header, headerBlock, sizeof(header));
+
+        ok = ok && header.Magic == HEADER::ExpectedMagic && header.Version == HEADER::CurrentVersion &&
+                   header.HeaderBytes == HeaderBytes && header.BytesUsed <= capacity;
+
+        if (ok)
+            ok = std::fread(data, 1, static_cast<size_t>(header.BytesUsed), file) == header.BytesUsed;
+
+        std::fclose(file);
+#endif
+
+        if (!ok)
+            return false;
+
+        bytesUsed = static_cast<size_t>(header.BytesUsed);
+        maxBytesUsed = static_cast<size_t>(header.MaxBytesUsed);
+        return true;
+    }
+}
+
+#undef __MEMORY_SNAPSHOT_POSIX
+
+#endif
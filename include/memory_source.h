@@ -0,0 +1,201 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_source.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_SOURCE_H_GUARD
+#define __MEMORY_SOURCE_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include <cassert>      // assert
+#include "memory_align.h"
+#include "memory_debug.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>   // mmap, munmap
+#include <unistd.h>     // sysconf
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Memory sources: where BASIC_MEMORY_BLOCK gets its memory from.
+//
+// A source is any type providing two static functions:
+//     static void* Allocate(size_t sizeInBytes, size_t alignment) noexcept;    // nullptr on failure
+//     static void  Release(void* head, size_t sizeInBytes) noexcept;           // must accept nullptr
+// The block calls them once each, at construction and destruction, and never on the pool's take
+// path, so a source costs nothing per allocation and needs no virtual dispatch. Sources are
+// stateless types; anything they need lives in static storage, keyed by a tag type where a
+// program needs several independent instances.
+// ----------------------------------------------------------------------------
+
+
+/// <summary>
+/// The default source: the C heap, at the requested alignment (see MemoryAlign::Allocate).
+/// With MEMORYCPP_POOL_DEBUG defined in a debug build, blocks are mapped between guard pages instead.
+/// </summary>
+struct HEAP_MEMORY_SOURCE
+{
+    [[nodiscard]] static inline void* Allocate(size_t sizeInBytes, size_t alignment) noexcept
+    {
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+        return MemoryDebug::AllocateGuarded(sizeInBytes, alignment);
+#else
+        return MemoryAlign::Allocate(sizeInBytes, alignment);
+#endif
+    }
+
+    static inline void Release(void* head, size_t sizeInBytes) noexcept
+    {
+#if defined(MEMORYCPP_POOL_DEBUG_ENABLED)
+        MemoryDebug::FreeGuarded(head, sizeInBytes);
+#else
+        (void)sizeInBytes;
+        MemoryAlign::Free(head);
+#endif
+    }
+};
+
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/// <summary>
+/// Anonymous private mappings straight from the kernel, bypassing the heap entirely.
+/// Blocks are at least page aligned and are returned to the system in full on release,
+/// which keeps large, long-lived pools from fragmenting the heap. POSIX only.
+/// </summary>
+struct MMAP_MEMORY_SOURCE
+{
+    [[nodiscard]] static inline void* Allocate(size_t sizeInBytes, size_t alignment) noexcept
+    {
+        const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t mappedBytes = (sizeInBytes + pageSize - 1) & ~(pageSize - 1);
+        const size_t slack = alignment > pageSize ? alignment - pageSize : 0;      // Over-map, then trim to the alignment
+
+        void* mapping = ::mmap(nullptr, mappedBytes + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED)
+            return nullptr;
+
+        if (slack == 0)
+            return mapping;
+
+        const uintptr_t base = reinterpret_cast<uintptr_t>(mapping);
+        const uintptr_t head = (base + alignment - 1) & ~(uintptr_t(alignment) - 1);
+
+        if (head > base)
+            ::munmap(mapping, head - base);
+        if (head + mappedBytes < base + mappedBytes + slack)
+            ::munmap(reinterpret_cast<void*>(head + mappedBytes), base + slack - head);
+
+        return reinterpret_cast<void*>(head);
+    }
+
+    static inline void Release(void* head, size_t sizeInBytes) noexcept
+    {
+        if (head != nullptr)
+            ::munmap(head, sizeInBytes);
+    }
+};
+
+#endif
+
+
+/// <summary>
+/// Carves blocks out of a fixed static buffer of Bytes bytes, so pools never touch the heap.
+/// Blocks are handed out in order; releasing the most recent block returns its space, and the
+/// whole buffer becomes available again once every block has been released. Allocation fails
+/// (and MEMORY_BLOCK asserts) once the buffer is exhausted.
+/// Each distinct TAG gets its own buffer. Not thread-safe.
+/// </summary>
+/// <typeparam name="Bytes">The size of the static buffer.</typeparam>
+/// <typeparam name="Align">The alignment of the buffer itself. Defaults to a cache line.</typeparam>
+/// <typeparam name="TAG">Any type, used only to give this source its own buffer.</typeparam>
+template<size_t Bytes, size_t Align = MemoryAlign::CacheLine, typename TAG = void>
+struct STATIC_MEMORY_SOURCE
+{
+    alignas(Align) static inline unsigned char Storage[Bytes];
+    static inline size_t Used = 0;          // Bytes carved so far, including alignment padding
+    static inline size_t LiveBlocks = 0;
+
+    [[nodiscard]] static inline void* Allocate(size_t sizeInBytes, size_t alignment) noexcept
+    {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(Storage);
+        const uintptr_t aligned = (base + Used + (alignment - 1)) & ~(uintptr_t(alignment) - 1);
+        const size_t offset = static_cast<size_t>(aligned - base);
+
+        if (offset > Bytes || sizeInBytes > Bytes - offset)
+            return nullptr;
+
+        Used = offset + sizeInBytes;
+        ++LiveBlocks;
+        return Storage + offset;
+    }
+
+    static inline void Release(void* head, size_t sizeInBytes) noexcept
+    {
+        if (head == nullptr)
+            return;
+
+        unsigned char* block = static_cast<unsigned char*>(head);
+        if (block + sizeInBytes == Storage + Used)                      // The newest block gives its space straight back
+            Used = static_cast<size_t>(block - Storage);
+
+        if (--LiveBlocks == 0)
+            Used = 0;
+    }
+};
+
+
+/// <summary>
+/// Forwards to user-supplied functions, for slab providers, jemalloc arenas and other
+/// deployment-specific memory. Install the callbacks with SetCallbacks before the first block is
+/// constructed; the context pointer is passed back on every call.
+/// Each distinct TAG has its own callbacks, so several providers can coexist.
+/// </summary>
+/// <typeparam name="TAG">Any type, used only to give this source its own callbacks.</typeparam>
+template<typename TAG = void>
+struct CALLBACK_MEMORY_SOURCE
+{
+    using ALLOCATE_CALLBACK = void* (*)(void* context, size_t sizeInBytes, size_t alignment);
+    using RELEASE_CALLBACK = void (*)(void* context, void* head, size_t sizeInBytes);
+
+    static inline ALLOCATE_CALLBACK AllocateCallback = nullptr;
+    static inline RELEASE_CALLBACK ReleaseCallback = nullptr;
+    static inline void* Context = nullptr;
+
+    /// <summary>
+    /// Installs the functions every block using this source allocates and releases through.
+    /// </summary>
+    static inline void SetCallbacks(ALLOCATE_CALLBACK allocate, RELEASE_CALLBACK release, void* context = nullptr) noexcept
+    {
+        AllocateCallback = allocate;
+        ReleaseCallback = release;
+        Context = context;
+    }
+
+    [[nodiscard]] static inline void* Allocate(size_t sizeInBytes, size_t alignment) noexcept
+    {
+        assert(AllocateCallback != nullptr && "CALLBACK_MEMORY_SOURCE: SetCallbacks must be called before allocating!");
+        return AllocateCallback ? AllocateCallback(Context, sizeInBytes, alignment) : nullptr;
+    }
+
+    static inline void Release(void* head, size_t sizeInBytes) noexcept
+    {
+        if (head != nullptr && ReleaseCallback != nullptr)
+            ReleaseCallback(Context, head, sizeInBytes);
+    }
+};
+
+#endif
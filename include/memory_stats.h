@@ -0,0 +1,220 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        memory_stats.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __MEMORY_STATS_H_GUARD
+#define __MEMORY_STATS_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cassert>      // assert
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // _BitScanReverse64
+#endif
+
+
+// ----------------------------------------------------------------------------
+// Pool statistics.
+//
+// Define MEMORYCPP_POOL_STATS (consistently, in every translation unit) to have every
+// BASIC_MEMORY_POOL count its allocations, failed allocations, padding and resets. The counters
+// are plain increments on the take and reset paths. Without the define the counters do not exist,
+// the take path is unchanged, and GetStats returns zeros, so code that exports statistics compiles
+// either way.
+//
+// Define MEMORYCPP_POOL_HISTORY to also keep a POOL_HISTORY per pool: the bytes used in each of the
+// last MEMORYCPP_POOL_HISTORY_EPOCHS epochs (the spans between Reset calls) and a log2 histogram of
+// request sizes, from which p50/p99 usage and request size can be read. Recording is a store and an
+// increment per Reset and a bit scan and an increment per take; the history adds about 1 KB per pool.
+// ----------------------------------------------------------------------------
+
+#if defined(MEMORYCPP_POOL_STATS)
+#define MEMORYCPP_POOL_STATS_ENABLED 1
+#endif
+
+#if defined(MEMORYCPP_POOL_HISTORY)
+#define MEMORYCPP_POOL_HISTORY_ENABLED 1
+#endif
+
+#if !defined(MEMORYCPP_POOL_HISTORY_EPOCHS)
+#define MEMORYCPP_POOL_HISTORY_EPOCHS 64
+#endif
+
+
+/// <summary>
+/// Counters kept by a pool when MEMORYCPP_POOL_STATS is defined.
+/// </summary>
+struct POOL_STATS
+{
+    size_t AllocationCount = 0;     // Slices handed out
+    size_t FailureCount = 0;        // Takes that returned a null slice
+    size_t PaddingBytes = 0;        // Bytes consumed beyond what was requested: alignment padding and rounding to 8
+    size_t ResetCount = 0;
+
+    POOL_STATS& operator+=(const POOL_STATS& other) noexcept
+    {
+        AllocationCount += other.AllocationCount;
+        FailureCount += other.FailureCount;
+        PaddingBytes += other.PaddingBytes;
+        ResetCount += other.ResetCount;
+        return *this;
+    }
+};
+
+
+/// <summary>
+/// Usage per reset epoch in a fixed-size ring, plus a histogram of request sizes bucketed by
+/// floor(log2(size)), kept by a pool when MEMORYCPP_POOL_HISTORY is defined.
+/// Where the lifetime high-water mark only says the worst epoch used 900 MB, the percentiles
+/// show whether that was typical or a single spike.
+/// </summary>
+struct POOL_HISTORY
+{
+    static constexpr size_t EpochCapacity = MEMORYCPP_POOL_HISTORY_EPOCHS;
+    static constexpr size_t BucketCount = sizeof(size_t) * 8;
+
+    static_assert(EpochCapacity > 0 && (EpochCapacity & (EpochCapacity - 1)) == 0, "MEMORYCPP_POOL_HISTORY_EPOCHS must be a power of two!");
+
+    size_t Epochs[EpochCapacity] = {};      // Bytes used by each epoch, the newest at (EpochCount - 1) % EpochCapacity
+    size_t EpochCount = 0;                  // Epochs recorded over the pool's lifetime; only the last EpochCapacity are kept
+    size_t SizeBuckets[BucketCount] = {};   // SizeBuckets[b] counts requests in [2^b, 2^(b+1))
+
+    [[nodiscard]] static inline size_t FloorLog2(size_t value) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long bit;
+        _BitScanReverse64(&bit, value);
+        return bit;
+#else
+        return BucketCount - 1 - static_cast<size_t>(__builtin_clzll(value));
+#endif
+    }
+
+    /// <summary>
+    /// Records the bytes used by an epoch that has just ended. Called by Reset.
+    /// </summary>
+    inline void RecordEpoch(size_t bytesUsed) noexcept
+    {
+        Epochs[EpochCount++ & (EpochCapacity - 1)] = bytesUsed;
+    }
+
+    /// <summary>
+    /// Records one request of sizeInBytes, which must be non-zero. Called by the take functions.
+    /// </summary>
+    inline void RecordSize(size_t sizeInBytes) noexcept
+    {
+        ++SizeBuckets[FloorLog2(sizeInBytes)];
+    }
+
+    /// <summary>
+    /// Returns the number of epochs currently held in the ring.
+    /// </summary>
+    [[nodiscard]] inline size_t RetainedEpochs() const noexcept
+    {
+        return EpochCount < EpochCapacity ? EpochCount : EpochCapacity;
+    }
+
+    /// <summary>
+    /// Returns the nearest-rank percentile of bytes used across the retained epochs, e.g. 50 or 99.
+    /// Sorts a copy of the ring, so this is for reporting, not for hot paths.
+    /// </summary>
+    /// <param name="percent">The percentile, 0 to 100.</param>
+    /// <returns>The usage at that percentile, or 0 if no epoch has been recorded.</returns>
+    [[nodiscard]] size_t EpochPercentile(size_t percent) const noexcept
+    {
+        assert(percent <= 100 && "EpochPercentile: percent must be 0 to 100!");
+
+        const size_t count = RetainedEpochs();
+        if (count == 0)
+            return 0;
+
+        size_t sorted[EpochCapacity];
+        for (size_t i = 0; i < count; ++i)                              // Insertion sort; the ring is small
+        {
+            size_t j = i;
+            for (; j > 0 && sorted[j - 1] > Epochs[i]; --j)
+                sorted[j] = sorted[j - 1];
+            sorted[j] = Epochs[i];
+        }
+
+        if (percent > 100)
+            percent = 100;
+
+        const size_t rank = (percent * count + 99) / 100;
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+
+    /// <summary>
+    /// Returns an upper bound on the request size at the given percentile: the top of the first
+    /// power-of-two bucket at which that share of requests has been reached.
+    /// </summary>
+    /// <param name="percent">The percentile, 0 to 100.</param>
+    /// <returns>The largest size in that bucket, or 0 if no request has been recorded.</returns>
+    [[nodiscard]] size_t SizePercentile(size_t percent) const noexcept
+    {
+        assert(percent <= 100 && "SizePercentile: percent must be 0 to 100!");
+
+        size_t total = 0;
+        for (size_t b = 0; b < BucketCount; ++b)
+            total += SizeBuckets[b];
+
+        if (total == 0)
+            return 0;
+
+        if (percent > 100)
+            percent = 100;
+
+        const size_t target = (percent * total + 99) / 100;
+        size_t seen = 0;
+        for (size_t b = 0; b < BucketCount; ++b)
+        {
+            seen += SizeBuckets[b];
+            if (seen >= target && seen > 0)
+                return b + 1 < BucketCount ? (size_t(2) << b) - 1 : ~size_t(0);
+        }
+        return ~size_t(0);
+    }
+};
+
+
+/// <summary>
+/// A point-in-time copy of one pool's usage and statistics, as gathered by MEMORY_MANAGER::Snapshot.
+/// A slot with no pool reports Exists false and zeros throughout.
+/// </summary>
+struct POOL_SNAPSHOT
+{
+    bool Exists = false;
+    size_t Size = 0;
+    size_t BytesUsed = 0;
+    size_t MaxBytesUsed = 0;        // The larger of the lifetime high-water mark and the current usage
+    POOL_STATS Stats;
+
+    /// <summary>
+    /// Captures any pool exposing Size, BytesUsed, GetMaxBytesUsed and GetStats.
+    /// </summary>
+    template<typename POOL>
+    [[nodiscard]] static POOL_SNAPSHOT Of(const POOL& pool) noexcept
+    {
+        POOL_SNAPSHOT snapshot;
+        snapshot.Exists = true;
+        snapshot.Size = pool.Size();
+        snapshot.BytesUsed = pool.BytesUsed();
+        snapshot.MaxBytesUsed = pool.GetMaxBytesUsed() > pool.BytesUsed() ? pool.GetMaxBytesUsed() : pool.BytesUsed();
+        snapshot.Stats = pool.GetStats();
+        return snapshot;
+    }
+};
+
+#endif
@@ -0,0 +1,178 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        numa_memory_manager.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __NUMA_MEMORY_MANAGER_H_GUARD
+#define __NUMA_MEMORY_MANAGER_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cassert>      // assert
+#include <new>          // std::nothrow
+#include "memory_pool.h"
+#include "memory_numa.h"
+
+
+/// <summary>
+/// Owns one MEMORY_POOL per NUMA node, each bound to its node before first touch, and routes
+/// allocations to the pool on the caller's node so threads work on local memory.
+/// If the local pool is exhausted, the other nodes' pools are tried in order, trading locality for success.
+/// On a single-node machine this is simply one unbound pool.
+///
+/// Routing costs a getcpu system call; hot loops should fetch GetLocalPool once and allocate from it directly.
+/// The pools themselves are not thread-safe: give each node one allocating thread, or synchronize
+/// threads that share a node.
+/// Not copyable. Not movable.
+/// </summary>
+/// <typeparam name="MaxNodes">The maximum number of nodes to create pools for. Higher nodes share pools modulo this count.</typeparam>
+template<size_t MaxNodes = 8>
+class NUMA_MEMORY_MANAGER
+{
+    static_assert(MaxNodes > 0, "NUMA_MEMORY_MANAGER requires at least one node!");
+
+    private:
+        MEMORY_POOL* _Pools[MaxNodes];
+        size_t _NodeCount = 0;
+
+    public:
+
+        /// <summary>
+        /// Creates a pool of poolSize bytes for each NUMA node and binds it to that node.
+        /// If any pool cannot be allocated, the ones already created are freed and the manager is left
+        /// with no pools; check IsNullPtr or the bool conversion afterwards.
+        /// </summary>
+        /// <param name="poolSize">The size in bytes of each node's pool.</param>
+        explicit NUMA_MEMORY_MANAGER(size_t poolSize)
+        {
+            const size_t nodes = MemoryNuma::GetNodeCount();
+            _NodeCount = nodes < MaxNodes ? nodes : MaxNodes;
+
+            for (size_t i = 0; i < MaxNodes; ++i)
+            {
+                _Pools[i] = nullptr;
+            }
+
+            for (size_t i = 0; i < _NodeCount; ++i)
+            {
+                _Pools[i] = new (std::nothrow) MEMORY_POOL(poolSize);
+
+                if (_Pools[i] == nullptr)
+                {
+                    for (size_t j = 0; j < i; ++j)
+                    {
+                        delete _Pools[j];
+                        _Pools[j] = nullptr;
+                    }
+
+                    _NodeCount = 0;
+                    return;
+                }
+
+                if (_NodeCount > 1)
+                    _Pools[i]->BindToNode(static_cast<unsigned>(i));       // A node that refuses the binding still works, just without placement
+            }
+        }
+
+        ~NUMA_MEMORY_MANAGER()
+        {
+            for (size_t i = 0; i < _NodeCount; ++i)
+            {
+                delete _Pools[i];
+            }
+        }
+
+        NUMA_MEMORY_MANAGER(const NUMA_MEMORY_MANAGER&) = delete;
+        NUMA_MEMORY_MANAGER& operator=(const NUMA_MEMORY_MANAGER&) = delete;
+        NUMA_MEMORY_MANAGER(NUMA_MEMORY_MANAGER&&) = delete;
+        NUMA_MEMORY_MANAGER& operator=(NUMA_MEMORY_MANAGER&&) = delete;
+
+        /// <summary>
+        /// Returns the number of node pools, which is 1 on a single-node machine and 0 if construction failed.
+        /// </summary>
+        [[nodiscard]] size_t NodeCount() const noexcept { return _NodeCount; }
+
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _NodeCount == 0; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _NodeCount != 0; }
+
+        /// <summary>
+        /// Returns the index of the pool serving the calling thread's current node.
+        /// </summary>
+        [[nodiscard]] size_t GetLocalNode() const noexcept
+        {
+            return _NodeCount > 1 ? MemoryNuma::GetCurrentNode() % _NodeCount : 0;
+        }
+
+        /// <summary>
+        /// Returns the pool bound to the specified node.
+        /// </summary>
+        [[nodiscard]] inline MEMORY_POOL& GetPool(size_t node) noexcept
+        {
+            assert(node < _NodeCount && "GetPool: node index out of bounds!");
+            return *_Pools[node];
+        }
+
+        /// <summary>
+        /// Returns the pool bound to the calling thread's current node.
+        /// </summary>
+        [[nodiscard]] inline MEMORY_POOL& GetLocalPool() noexcept
+        {
+            assert(_NodeCount != 0 && "GetLocalPool: the manager has no pools!");
+            return *_Pools[GetLocalNode()];
+        }
+
+        /// <summary>
+        /// Carves a slice from the caller's local pool, falling back to the other nodes if it is full.
+        /// </summary>
+        /// <param name="sizeInBytes">The number of bytes requested.</param>
+        /// <returns>The slice if successful; otherwise a null slice if every pool is exhausted.</returns>
+        MEMORY_SLICE TakeSlice(size_t sizeInBytes)
+        {
+            return TakeAlignedSlice(sizeInBytes, 8);
+        }
+
+        /// <summary>
+        /// Carves an aligned slice from the caller's local pool, falling back to the other nodes if it is full.
+        /// </summary>
+        /// <param name="sizeInBytes">The number of bytes requested.</param>
+        /// <param name="alignment">The required alignment in bytes. Must be a non-zero power of two.</param>
+        /// <returns>The slice if successful; otherwise a null slice if every pool is exhausted.</returns>
+        MEMORY_SLICE TakeAlignedSlice(size_t sizeInBytes, size_t alignment)
+        {
+            const size_t local = GetLocalNode();
+
+            for (size_t i = 0; i < _NodeCount; ++i)
+            {
+                const size_t node = (local + i) % _NodeCount;
+                MEMORY_SLICE slice = _Pools[node]->TakeAlignedSlice(sizeInBytes, alignment);
+
+                if (!slice.IsNullPtr())
+                    return slice;
+            }
+
+            return MEMORY_SLICE(nullptr, 0);
+        }
+
+        /// <summary>
+        /// Resets every node's pool. Does not call destructors on any allocated objects.
+        /// </summary>
+        void ResetAll() noexcept
+        {
+            for (size_t i = 0; i < _NodeCount; ++i)
+            {
+                _Pools[i]->Reset();
+            }
+        }
+};
+
+#endif
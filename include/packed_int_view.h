@@ -0,0 +1,319 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        packed_int_view.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __PACKED_INT_VIEW_H_GUARD
+#define __PACKED_INT_VIEW_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <cstring>      // memcpy
+#include <cassert>      // assert
+#include "memory_slice.h"
+
+
+/// <summary>
+/// A non-owning view that stores unsigned integers of a fixed bit width (1 to 32 bits) back to back
+/// inside a MEMORY_SLICE. Element i occupies bits [i * width, (i + 1) * width) using the same
+/// LSB-first bit numbering as MEMORY_SLICE::GetBit, so the two APIs agree on layout.
+/// Single element access reads or writes one unaligned 64-bit window; bulk Pack and Unpack stream
+/// through a 64-bit accumulator and touch each byte of the slice once.
+/// Copyable since it carries no ownership semantics. Not thread-safe.
+/// </summary>
+class PACKED_INT_VIEW
+{
+    private:
+        MEMORY_SLICE _Slice;            // Backing memory
+        uint32_t _BitWidth = 0;         // Bits per element
+        uint32_t _Mask = 0;             // Low _BitWidth bits set
+        size_t _Count = 0;              // Number of whole elements that fit in the slice
+
+        /// <summary>
+        /// Loads up to 8 bytes starting at p as a little-endian integer.
+        /// Reads a full 64-bit word when available bytes allow it and falls back to a byte loop near the end of the slice.
+        /// </summary>
+        [[nodiscard]] static inline uint64_t LoadWindow(const unsigned char* p, size_t available) noexcept
+        {
+            uint64_t word = 0;
+
+            if (available >= 8)
+            {
+                std::memcpy(&word, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                word = __builtin_bswap64(word);
+#endif
+                return word;
+            }
+
+            for (size_t i = 0; i < available; ++i)
+                word |= static_cast<uint64_t>(p[i]) << (i * 8);
+
+            return word;
+        }
+
+        /// <summary>
+        /// Stores the low byteCount bytes of word at p in little-endian order.
+        /// </summary>
+        static inline void StoreWindow(unsigned char* p, uint64_t word, size_t byteCount) noexcept
+        {
+            if (byteCount == 8)
+            {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                word = __builtin_bswap64(word);
+#endif
+                std::memcpy(p, &word, 8);
+                return;
+            }
+
+            for (size_t i = 0; i < byteCount; ++i)
+                p[i] = static_cast<unsigned char>(word >> (i * 8));
+        }
+
+        /// <summary>
+        /// Loads 4 bytes starting at p as a little-endian integer.
+        /// </summary>
+        [[nodiscard]] static inline uint64_t Load32(const unsigned char* p) noexcept
+        {
+            uint32_t value;
+            std::memcpy(&value, p, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap32(value);
+#endif
+            return value;
+        }
+
+        /// <summary>
+        /// Stores the low 32 bits of word at p in little-endian order.
+        /// </summary>
+        static inline void Store32(unsigned char* p, uint64_t word) noexcept
+        {
+            uint32_t value = static_cast<uint32_t>(word);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            value = __builtin_bswap32(value);
+#endif
+            std::memcpy(p, &value, 4);
+        }
+
+        [[nodiscard]] inline unsigned char* Bytes() const noexcept { return static_cast<unsigned char*>(_Slice.GetHead()); }
+
+    public:
+
+        /// <summary>
+        /// Constructs a packed view over an existing slice.
+        /// The element count is the number of whole elements of bitWidth bits that fit in the slice.
+        /// Asserts in debug if the slice is null or the bit width is outside [1, 32].
+        /// </summary>
+        /// <param name="slice">The memory to pack elements into.</param>
+        /// <param name="bitWidth">The number of bits per element, from 1 to 32.</param>
+        explicit PACKED_INT_VIEW(const MEMORY_SLICE& slice, uint32_t bitWidth) noexcept
+            : _Slice(slice), _BitWidth(bitWidth), _Mask(bitWidth >= 32 ? 0xFFFFFFFFu : ((1u << bitWidth) - 1u)), _Count(0)
+        {
+            assert(!slice.IsNullPtr() && "PACKED_INT_VIEW: cannot view a null slice!");
+            assert(bitWidth >= 1 && bitWidth <= 32 && "PACKED_INT_VIEW: bit width must be between 1 and 32!");
+
+            _Count = (bitWidth >= 1 && bitWidth <= 32) ? (slice.GetBitCount() / bitWidth) : 0;
+        }
+
+        ~PACKED_INT_VIEW() = default;
+        PACKED_INT_VIEW(const PACKED_INT_VIEW&) = default;
+        PACKED_INT_VIEW& operator=(const PACKED_INT_VIEW&) = default;
+        PACKED_INT_VIEW(PACKED_INT_VIEW&&) = default;
+        PACKED_INT_VIEW& operator=(PACKED_INT_VIEW&&) = default;
+
+        /// <summary>
+        /// Returns the number of bytes needed to hold count elements of bitWidth bits.
+        /// Use this to size the slice passed to the constructor, e.g. pool.TakeSlice(RequiredBytes(n, 17)).
+        /// </summary>
+        /// <param name="count">The number of elements to store.</param>
+        /// <param name="bitWidth">The number of bits per element.</param>
+        /// <returns>The minimum slice size in bytes.</returns>
+        [[nodiscard]] static constexpr size_t RequiredBytes(size_t count, uint32_t bitWidth) noexcept
+        {
+            return (count * bitWidth + 7) / 8;
+        }
+
+        /// <summary>
+        /// Returns the smallest bit width able to represent every value in [0, maxValue].
+        /// </summary>
+        /// <param name="maxValue">The largest value that will be stored.</param>
+        /// <returns>The bit width, from 1 to 32.</returns>
+        [[nodiscard]] static constexpr uint32_t BitsRequired(uint32_t maxValue) noexcept
+        {
+            uint32_t bits = 1;
+            while (bits < 32 && (maxValue >> bits) != 0)
+                ++bits;
+            return bits;
+        }
+
+        [[nodiscard]] inline size_t GetCount() const noexcept { return _Count; }
+        [[nodiscard]] inline uint32_t GetBitWidth() const noexcept { return _BitWidth; }
+        [[nodiscard]] inline uint32_t GetMaxValue() const noexcept { return _Mask; }
+        [[nodiscard]] inline const MEMORY_SLICE& GetSlice() const noexcept { return _Slice; }
+
+        /// <summary>
+        /// Returns the element at the specified index.
+        /// Asserts in debug if the index is out of range.
+        /// </summary>
+        /// <param name="index">The zero-based element index.</param>
+        /// <returns>The stored value, zero-extended to 32 bits.</returns>
+        [[nodiscard]] inline uint32_t Get(size_t index) const noexcept
+        {
+            assert(index < _Count && "Get: element index out of range!");
+
+            const size_t bitPos = index * _BitWidth;
+            const size_t byteIndex = bitPos >> 3;
+            const uint64_t word = LoadWindow(Bytes() + byteIndex, _Slice.GetSize() - byteIndex);   // width + 7 <= 39 bits, always inside one window
+
+            return static_cast<uint32_t>(word >> (bitPos & 7)) & _Mask;
+        }
+
+        /// <summary>
+        /// Stores a value at the specified index. Bits above the bit width are discarded.
+        /// Asserts in debug if the index is out of range or the value does not fit in the bit width.
+        /// </summary>
+        /// <param name="index">The zero-based element index.</param>
+        /// <param name="value">The value to store.</param>
+        inline void Set(size_t index, uint32_t value) noexcept
+        {
+            assert(index < _Count && "Set: element index out of range!");
+            assert((value & ~_Mask) == 0 && "Set: value does not fit in the bit width!");
+
+            const size_t bitPos = index * _BitWidth;
+            const size_t byteIndex = bitPos >> 3;
+            const size_t shift = bitPos & 7;
+            const size_t available = _Slice.GetSize() - byteIndex;
+            const size_t touched = (shift + _BitWidth + 7) >> 3;                 // Bytes actually covered by this element
+
+            unsigned char* p = Bytes() + byteIndex;
+            uint64_t word = LoadWindow(p, available);
+
+            word &= ~(static_cast<uint64_t>(_Mask) << shift);
+            word |= static_cast<uint64_t>(value & _Mask) << shift;
+
+            StoreWindow(p, word, available >= 8 ? 8 : touched);
+        }
+
+        /// <summary>
+        /// Packs count values into consecutive elements starting at startIndex.
+        /// Values are masked to the bit width. Elements outside the written range are preserved.
+        /// Asserts in debug if the range exceeds the view.
+        /// </summary>
+        /// <param name="values">The source array of 32-bit values.</param>
+        /// <param name="count">The number of values to pack.</param>
+        /// <param name="startIndex">The first element to write. Defaults to 0.</param>
+        /// <returns>The number of elements written, or 0 if the range exceeds the view.</returns>
+        size_t Pack(const uint32_t* values, size_t count, size_t startIndex = 0) noexcept
+        {
+            assert(values != nullptr && "Pack: source array cannot be null!");
+            assert(startIndex <= _Count && count <= _Count - startIndex && "Pack: range exceeds view bounds!");
+
+            if (startIndex > _Count || count > _Count - startIndex || count == 0)
+                return 0;
+
+            const size_t bitPos = startIndex * _BitWidth;
+            unsigned char* out = Bytes() + (bitPos >> 3);
+            size_t fill = bitPos & 7;                                               // Bits currently held in the accumulator
+            uint64_t acc = out[0] & ((1u << fill) - 1u);                            // Preserve the element bits that precede startIndex
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                acc |= static_cast<uint64_t>(values[i] & _Mask) << fill;
+                fill += _BitWidth;
+
+                if (fill >= 32)                                                     // Flush a full 32-bit word, fill stays below 64
+                {
+                    Store32(out, acc);
+                    out += 4;
+                    acc >>= 32;
+                    fill -= 32;
+                }
+            }
+
+            while (fill >= 8)                                                       // Flush remaining whole bytes
+            {
+                *out++ = static_cast<unsigned char>(acc);
+                acc >>= 8;
+                fill -= 8;
+            }
+
+            if (fill > 0)                                                           // Merge the final partial byte with the bits that follow
+            {
+                const unsigned char low = static_cast<unsigned char>((1u << fill) - 1u);
+                *out = static_cast<unsigned char>((*out & ~low) | (acc & low));
+            }
+
+            return count;
+        }
+
+        /// <summary>
+        /// Unpacks count consecutive elements starting at startIndex into a 32-bit array.
+        /// Asserts in debug if the range exceeds the view.
+        /// </summary>
+        /// <param name="out">The destination array, which must hold at least count values.</param>
+        /// <param name="count">The number of elements to read.</param>
+        /// <param name="startIndex">The first element to read. Defaults to 0.</param>
+        /// <returns>The number of elements read, or 0 if the range exceeds the view.</returns>
+        size_t Unpack(uint32_t* out, size_t count, size_t startIndex = 0) const noexcept
+        {
+            assert(out != nullptr && "Unpack: destination array cannot be null!");
+            assert(startIndex <= _Count && count <= _Count - startIndex && "Unpack: range exceeds view bounds!");
+
+            if (startIndex > _Count || count > _Count - startIndex || count == 0)
+                return 0;
+
+            const size_t bitPos = startIndex * _BitWidth;
+            const unsigned char* in = Bytes() + (bitPos >> 3);
+            const unsigned char* end = Bytes() + _Slice.GetSize();
+
+            uint64_t acc = 0;
+            size_t avail = 0;                                                       // Valid bits held in the accumulator
+            size_t skip = bitPos & 7;                                               // Leading bits that belong to the previous element
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                while (avail < _BitWidth + skip && in < end)                        // Refill, avail stays below 64
+                {
+                    const size_t remaining = static_cast<size_t>(end - in);
+                    const size_t take = remaining >= 4 ? 4 : remaining;
+                    acc |= (take == 4 ? Load32(in) : LoadWindow(in, take)) << avail;
+                    in += take;
+                    avail += take * 8;
+
+                    if (skip)
+                    {
+                        acc >>= skip;
+                        avail -= skip;
+                        skip = 0;
+                    }
+                }
+
+                out[i] = static_cast<uint32_t>(acc) & _Mask;
+                acc >>= _BitWidth;
+                avail -= _BitWidth;
+            }
+
+            return count;
+        }
+
+        /// <summary>
+        /// Sets every element in the view to zero.
+        /// </summary>
+        inline void Clear() noexcept
+        {
+            _Slice.Zero();
+        }
+};
+
+#endif
@@ -0,0 +1,149 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        persistent_memory_pool.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __PERSISTENT_MEMORY_POOL_H_GUARD
+#define __PERSISTENT_MEMORY_POOL_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include "memory_pool.h"
+#include "mapped_memory_block.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+
+/// <summary>
+/// The metadata record stored in the first page of a persistent pool file.
+/// </summary>
+struct PERSISTENT_POOL_HEADER
+{
+    static constexpr uint64_t ExpectedMagic = 0x4C4F4F504D454D43ull;     // "CMEMPOOL"
+    static constexpr uint32_t CurrentVersion = 1;
+    static constexpr size_t ReservedBytes = 4096;                       // Keeps the arena page aligned
+
+    uint64_t Magic;
+    uint32_t Version;
+    uint32_t HeaderBytes;
+    uint64_t Capacity;              // Arena size when the header was last written
+    uint64_t NextOffset;            // Bump position at the last Sync
+    uint64_t MaxBytesUsed;
+};
+
+
+/// <summary>
+/// A MEMORY_POOL whose arena lives in a memory-mapped file, so its contents and allocation position
+/// survive process restarts. Opening an existing file remaps the arena and resumes bump allocation
+/// where the previous run left off; pages are faulted in lazily on first touch, so reopening a large
+/// arena costs a single mmap rather than a read of the whole file.
+///
+/// The bump offset lives in the pool object like any other MEMORY_POOL and is written to the file
+/// header by Sync and on destruction, keeping the allocation path identical to the heap pool.
+/// Allocations made after the last Sync are not remembered if the process dies without destructing.
+///
+/// Pointers stored inside the arena are only valid for the mapping that created them, since the
+/// file may map at a different address next run. Store REL_PTR values or offsets from GetBase() instead.
+/// Not copyable. Not thread-safe. POSIX only.
+/// </summary>
+class PERSISTENT_MEMORY_POOL : public BASIC_MEMORY_POOL<MAPPED_MEMORY_BLOCK>
+{
+    private:
+        bool _Restored = false;
+
+        [[nodiscard]] inline PERSISTENT_POOL_HEADER* Header() const noexcept
+        {
+            return static_cast<PERSISTENT_POOL_HEADER*>(_Block.GetPrefix());
+        }
+
+    public:
+
+        /// <summary>
+        /// Opens or creates the pool file at path with an arena of the given size.
+        /// If the file holds a valid header whose saved offset fits in the arena, the previous
+        /// allocation position is restored; otherwise the arena starts empty and a fresh header is written.
+        /// Check IsNullPtr or the bool conversion afterwards; a pool that failed to map rejects every take.
+        /// </summary>
+        /// <param name="path">The file that backs the pool.</param>
+        /// <param name="sizeInBytes">The size of the arena in bytes, excluding the header page.</param>
+        PERSISTENT_MEMORY_POOL(const char* path, size_t sizeInBytes)
+            : BASIC_MEMORY_POOL<MAPPED_MEMORY_BLOCK>(path, sizeInBytes, PERSISTENT_POOL_HEADER::ReservedBytes)
+        {
+            PERSISTENT_POOL_HEADER* header = Header();
+            if (!header)
+                return;
+
+            if (header->Magic == PERSISTENT_POOL_HEADER::ExpectedMagic &&
+                header->Version == PERSISTENT_POOL_HEADER::CurrentVersion &&
+                header->HeaderBytes == PERSISTENT_POOL_HEADER::ReservedBytes &&
+                header->NextOffset <= sizeInBytes)
+            {
+                _NextOffset = static_cast<size_t>(header->NextOffset);
+                _MaxBytesUsed = static_cast<size_t>(header->MaxBytesUsed);
+                _Restored = true;
+                UnpoisonRange(0, _NextOffset);                                  // The restored slices are live
+            }
+            else
+            {
+                header->Magic = PERSISTENT_POOL_HEADER::ExpectedMagic;
+                header->Version = PERSISTENT_POOL_HEADER::CurrentVersion;
+                header->HeaderBytes = PERSISTENT_POOL_HEADER::ReservedBytes;
+                header->MaxBytesUsed = 0;
+            }
+
+            header->Capacity = sizeInBytes;
+            header->NextOffset = _NextOffset;
+        }
+
+        /// <summary>
+        /// Records the current allocation position in the file header.
+        /// </summary>
+        ~PERSISTENT_MEMORY_POOL()
+        {
+            Sync(false);
+        }
+
+        PERSISTENT_MEMORY_POOL(const PERSISTENT_MEMORY_POOL&) = delete;
+        PERSISTENT_MEMORY_POOL& operator=(const PERSISTENT_MEMORY_POOL&) = delete;
+
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Block.IsNullPtr(); }
+        [[nodiscard]] explicit operator bool() const noexcept { return !_Block.IsNullPtr(); }
+
+        /// <summary>
+        /// Returns true if the pool resumed from a previous run's header rather than starting empty.
+        /// </summary>
+        [[nodiscard]] inline bool WasRestored() const noexcept { return _Restored; }
+
+        /// <summary>
+        /// Writes the current allocation position to the file header and optionally flushes the
+        /// arena and header to disk. A restarted process resumes from the most recent Sync.
+        /// </summary>
+        /// <param name="durable">True to block until the data is on disk; false to only update the header in the page cache.</param>
+        /// <returns>True on success; false if the pool failed to map or the flush failed.</returns>
+        bool Sync(bool durable = true) noexcept
+        {
+            PERSISTENT_POOL_HEADER* header = Header();
+            if (!header)
+                return false;
+
+            header->NextOffset = _NextOffset;
+            header->MaxBytesUsed = _NextOffset > _MaxBytesUsed ? _NextOffset : _MaxBytesUsed;
+
+            return durable ? _Block.Flush(true) : true;
+        }
+};
+
+#endif
+
+#endif
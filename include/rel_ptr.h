@@ -0,0 +1,116 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        rel_ptr.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __REL_PTR_H_GUARD
+#define __REL_PTR_H_GUARD
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <cstdint>      // intptr_t
+#include <cassert>      // assert
+
+
+/// <summary>
+/// A pointer that stores the distance from its own address to its target instead of an absolute address.
+/// As long as the REL_PTR and its target live in the same block, the pair can be memcpy'd, written to
+/// disk, mmapped at another address or shared with another process and the pointer stays valid.
+/// This is what makes a pool image relocatable: store REL_PTRs inside pool memory wherever a raw
+/// pointer would otherwise be stored.
+///
+/// Assigning from or converting to T* is implicit, so results of Take and TakeArray can be stored
+/// directly and comparisons resolve through the raw pointer. Copying a REL_PTR re-targets the copy, so it points at the same object from its new address.
+///
+/// An offset of 1 represents null. Zero cannot be used because a struct whose first member is a
+/// REL_PTR to the same struct type may legitimately point at itself, and no object of T can start
+/// one byte into the REL_PTR's own storage.
+/// The offset type may be narrowed (e.g. int32_t) to halve the size for arenas under 2 GB;
+/// debug builds assert if a target is out of range.
+/// </summary>
+/// <typeparam name="T">The pointee type.</typeparam>
+/// <typeparam name="OFFSET">The signed integer type used to store the offset. Defaults to ptrdiff_t.</typeparam>
+template<typename T, typename OFFSET = ptrdiff_t>
+class REL_PTR
+{
+    static_assert(static_cast<OFFSET>(-1) < 0, "REL_PTR offset type must be signed!");
+
+    private:
+        static constexpr OFFSET NullOffset = 1;
+
+        OFFSET _Offset = NullOffset;
+
+        [[nodiscard]] inline OFFSET OffsetTo(const volatile void* target) const noexcept
+        {
+            if (target == nullptr)
+                return NullOffset;
+
+            const intptr_t distance = reinterpret_cast<intptr_t>(target) - reinterpret_cast<intptr_t>(this);
+            assert(static_cast<intptr_t>(static_cast<OFFSET>(distance)) == distance && "REL_PTR: target is out of range for the offset type!");
+
+            return static_cast<OFFSET>(distance);
+        }
+
+    public:
+
+        REL_PTR() noexcept = default;
+        REL_PTR(decltype(nullptr)) noexcept { }
+        REL_PTR(T* target) noexcept : _Offset(OffsetTo(target)) { }
+        REL_PTR(const REL_PTR& other) noexcept : _Offset(OffsetTo(other.Get())) { }
+        ~REL_PTR() = default;
+
+        REL_PTR& operator=(const REL_PTR& other) noexcept { _Offset = OffsetTo(other.Get()); return *this; }
+        REL_PTR& operator=(T* target) noexcept { _Offset = OffsetTo(target); return *this; }
+        REL_PTR& operator=(decltype(nullptr)) noexcept { _Offset = NullOffset; return *this; }
+
+        /// <summary>
+        /// Resolves the stored offset against this REL_PTR's current address.
+        /// </summary>
+        /// <returns>A raw pointer to the target, or nullptr if the REL_PTR is null.</returns>
+        [[nodiscard]] inline T* Get() const noexcept
+        {
+            if (_Offset == NullOffset)
+                return nullptr;
+
+            return reinterpret_cast<T*>(reinterpret_cast<intptr_t>(this) + static_cast<intptr_t>(_Offset));
+        }
+
+        /// <summary>
+        /// Returns the raw stored offset. Useful for serialization or debugging; 1 means null.
+        /// </summary>
+        [[nodiscard]] inline OFFSET GetOffset() const noexcept { return _Offset; }
+
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Offset == NullOffset; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Offset != NullOffset; }
+        [[nodiscard]] operator T*() const noexcept { return Get(); }
+
+        [[nodiscard]] inline T* operator->() const noexcept
+        {
+            assert(_Offset != NullOffset && "REL_PTR: cannot dereference a null pointer!");
+            return Get();
+        }
+
+        [[nodiscard]] inline T& operator*() const noexcept
+        {
+            assert(_Offset != NullOffset && "REL_PTR: cannot dereference a null pointer!");
+            return *Get();
+        }
+
+        [[nodiscard]] inline T& operator[](size_t index) const noexcept
+        {
+            assert(_Offset != NullOffset && "REL_PTR: cannot index a null pointer!");
+            return Get()[index];
+        }
+};
+
+#endif
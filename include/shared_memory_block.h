@@ -0,0 +1,184 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        shared_memory_block.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __SHARED_MEMORY_BLOCK_H_GUARD
+#define __SHARED_MEMORY_BLOCK_H_GUARD
+
+#include <cstddef>      // size_t
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <sys/mman.h>   // mmap, munmap, shm_open, shm_unlink, memfd_create
+#include <sys/stat.h>   // fstat
+#include <fcntl.h>      // O_* flags
+#include <unistd.h>     // close, dup, ftruncate
+
+
+/// <summary>
+/// A RAII wrapper around a shared memory object mapped read-write into this process.
+/// The object is either named (shm_open, visible to any process that knows the name) or anonymous
+/// (memfd_create on Linux, shared by forking or passing the descriptor over a Unix socket).
+/// Every process mapping the same object sees the same physical pages, so data written by one is
+/// readable in place by the others without copying.
+/// An optional reserved prefix is mapped ahead of the block for callers that keep shared metadata
+/// in the same object; GetHead and GetSize describe only the region after it.
+/// Failing to create or map the object is a runtime condition, so construction never asserts;
+/// check IsNullPtr or the bool conversion before use.
+/// Not copyable or movable; ownership is strict and non-transferable. POSIX only.
+/// </summary>
+class SHARED_MEMORY_BLOCK
+{
+    private:
+        void* _Mapping = nullptr;       // Start of the whole mapping, including the reserved prefix
+        size_t _MappingSize = 0;
+        void* _Head = nullptr;          // Start of the usable block, after the reserved prefix
+        size_t _SizeInBytes = 0;
+        int _FileDescriptor = -1;
+        bool _Created = false;          // True if this process created the object rather than attaching to it
+
+        /// <summary>
+        /// Sizes the object if requested and maps it. Called once the descriptor is open.
+        /// A requested size of 0 attaches to the object at its current size.
+        /// </summary>
+        void Map(size_t sizeInBytes, size_t reservedPrefix) noexcept
+        {
+            struct stat info;
+            if (::fstat(_FileDescriptor, &info) != 0)
+                return;
+
+            size_t total = reservedPrefix + sizeInBytes;
+
+            if (sizeInBytes == 0)
+            {
+                if (static_cast<size_t>(info.st_size) <= reservedPrefix)
+                    return;
+                total = static_cast<size_t>(info.st_size);
+            }
+            else if (static_cast<size_t>(info.st_size) < total)
+            {
+                if (::ftruncate(_FileDescriptor, static_cast<off_t>(total)) != 0)
+                    return;
+                _Created = (info.st_size == 0);
+            }
+
+            void* mapping = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, _FileDescriptor, 0);
+            if (mapping == MAP_FAILED)
+                return;
+
+            _Mapping = mapping;
+            _MappingSize = total;
+            _Head = static_cast<unsigned char*>(mapping) + reservedPrefix;
+            _SizeInBytes = total - reservedPrefix;
+        }
+
+    public:
+
+        /// <summary>
+        /// Creates or attaches to a shared memory object.
+        /// With a name, the object is opened with shm_open and, unless attaching, created if it does not exist.
+        /// With a null name, an anonymous memfd is created (Linux only).
+        /// Passing sizeInBytes = 0 attaches to an existing object at whatever size its creator chose.
+        /// </summary>
+        /// <param name="name">The shm_open name (e.g. "/frames"), or nullptr for an anonymous object.</param>
+        /// <param name="sizeInBytes">The size of the usable block in bytes, or 0 to attach at the existing size.</param>
+        /// <param name="reservedPrefix">Bytes mapped ahead of the block for shared metadata. Defaults to 0.</param>
+        SHARED_MEMORY_BLOCK(const char* name, size_t sizeInBytes, size_t reservedPrefix = 0)
+        {
+            if (name)
+            {
+                _FileDescriptor = ::shm_open(name, sizeInBytes != 0 ? O_RDWR | O_CREAT : O_RDWR, 0600);    // Attaching never creates
+            }
+            else
+            {
+#if defined(__linux__)
+                _FileDescriptor = ::memfd_create("MemoryCPP", MFD_CLOEXEC);
+#endif
+            }
+
+            if (_FileDescriptor < 0)
+                return;
+
+            Map(sizeInBytes, reservedPrefix);
+        }
+
+        /// <summary>
+        /// Attaches to a shared memory object through an existing descriptor, e.g. one inherited across
+        /// fork or received over a Unix socket. The descriptor is duplicated; the caller keeps ownership of theirs.
+        /// The whole object is mapped.
+        /// </summary>
+        /// <param name="fileDescriptor">A descriptor referring to a shared memory object or memfd.</param>
+        /// <param name="reservedPrefix">Bytes mapped ahead of the block for shared metadata. Defaults to 0.</param>
+        SHARED_MEMORY_BLOCK(int fileDescriptor, size_t reservedPrefix = 0)
+        {
+            _FileDescriptor = ::dup(fileDescriptor);
+            if (_FileDescriptor < 0)
+                return;
+
+            Map(0, reservedPrefix);
+        }
+
+        /// <summary>
+        /// Unmaps the object and closes this process's descriptor.
+        /// A named object persists until Unlink is called; an anonymous one is freed when its last descriptor closes.
+        /// </summary>
+        ~SHARED_MEMORY_BLOCK()
+        {
+            if (_Mapping)
+                ::munmap(_Mapping, _MappingSize);
+
+            if (_FileDescriptor >= 0)
+                ::close(_FileDescriptor);
+        }
+
+        SHARED_MEMORY_BLOCK(const SHARED_MEMORY_BLOCK&) = delete;
+        SHARED_MEMORY_BLOCK& operator=(const SHARED_MEMORY_BLOCK&) = delete;
+        SHARED_MEMORY_BLOCK(SHARED_MEMORY_BLOCK&&) = delete;
+        SHARED_MEMORY_BLOCK& operator=(SHARED_MEMORY_BLOCK&&) = delete;
+
+        [[nodiscard]] inline void* GetHead() const noexcept { return _Head; }
+        [[nodiscard]] inline size_t GetSize() const noexcept { return _SizeInBytes; }
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Head == nullptr; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+
+        /// <summary>
+        /// Returns a pointer to the reserved prefix at the start of the mapping, or nullptr if the mapping failed.
+        /// </summary>
+        [[nodiscard]] inline void* GetPrefix() const noexcept { return _Mapping; }
+
+        /// <summary>
+        /// Returns true if this process created or grew the object, meaning its contents started zeroed.
+        /// </summary>
+        [[nodiscard]] inline bool WasCreated() const noexcept { return _Created; }
+
+        /// <summary>
+        /// Returns the descriptor for the shared object, suitable for passing to another process.
+        /// </summary>
+        [[nodiscard]] inline int GetFileDescriptor() const noexcept { return _FileDescriptor; }
+
+        /// <summary>
+        /// Removes a named object from the shared memory namespace. Existing mappings stay valid.
+        /// </summary>
+        /// <param name="name">The name passed to the creating constructor.</param>
+        /// <returns>True if the name was removed.</returns>
+        static bool Unlink(const char* name) noexcept
+        {
+            return ::shm_unlink(name) == 0;
+        }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,314 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        shared_memory_pool.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __SHARED_MEMORY_POOL_H_GUARD
+#define __SHARED_MEMORY_POOL_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t, uintptr_t
+#include <atomic>       // std::atomic
+#include <new>          // placement new
+#include <cassert>      // assert
+#include "memory_slice.h"
+#include "shared_memory_block.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+
+/// <summary>
+/// The control record stored in the first page of a shared pool.
+/// Lives in shared memory, so every field that changes after creation is a lock-free atomic.
+/// </summary>
+struct SHARED_POOL_HEADER
+{
+    static constexpr uint64_t ExpectedMagic = 0x4C4F4F5052485343ull;     // "CSHRPOOL"
+    static constexpr size_t ReservedBytes = 4096;                       // Keeps the arena page aligned
+
+    std::atomic<uint64_t> Magic;            // Written last by the creator; attaching before then fails
+    uint64_t Capacity;
+    std::atomic<uint64_t> NextOffset;       // Bump position shared by every producer
+    std::atomic<uint64_t> PublishedOffset;  // Everything below this offset is fully written
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "SHARED_POOL_HEADER requires lock-free 64-bit atomics!");
+};
+
+
+/// <summary>
+/// A linear allocator whose arena and bump offset live in shared memory, so one process can
+/// allocate and fill slices that other processes read in place with no copy.
+///
+/// Producers call TakeSlice (or Take/TakeArray) exactly as with MEMORY_POOL; the offset is advanced
+/// with an atomic compare-exchange so multiple producer processes may allocate concurrently.
+/// After writing, a producer publishes the end of what it wrote; consumers read GetPublishedBytes
+/// with acquire semantics and may then read any byte below it. The published offset only moves
+/// forward, so concurrent publishers never undo each other. With a single producer, Publish() covers
+/// everything taken so far. With several, a publisher vouches for every byte below the offset it
+/// publishes, including other producers' slices, so they need their own ordering (one publishing
+/// producer, or taking turns).
+/// Slices are exchanged between processes as offsets (OffsetOf / SliceAt) because each process
+/// maps the arena at its own address; REL_PTR links inside the arena work unchanged.
+///
+/// Attaching fails (IsNullPtr) until the creator has finished initializing the header; retry if
+/// the two processes start together.
+/// Reset is only safe once every consumer has finished with the current contents.
+/// Not copyable. POSIX only.
+/// </summary>
+class SHARED_MEMORY_POOL
+{
+    private:
+        SHARED_MEMORY_BLOCK _Block;
+        SHARED_POOL_HEADER* _Header = nullptr;
+
+        void Attach(bool create) noexcept
+        {
+            if (_Block.IsNullPtr())
+                return;
+
+            SHARED_POOL_HEADER* header = static_cast<SHARED_POOL_HEADER*>(_Block.GetPrefix());
+
+            if (create)
+            {
+                new (header) SHARED_POOL_HEADER();
+                header->Capacity = _Block.GetSize();
+                header->NextOffset.store(0, std::memory_order_relaxed);
+                header->PublishedOffset.store(0, std::memory_order_relaxed);
+                header->Magic.store(SHARED_POOL_HEADER::ExpectedMagic, std::memory_order_release);
+            }
+            else if (header->Magic.load(std::memory_order_acquire) != SHARED_POOL_HEADER::ExpectedMagic ||
+                     header->Capacity > _Block.GetSize())
+            {
+                return;
+            }
+
+            _Header = header;
+        }
+
+    public:
+
+        /// <summary>
+        /// Creates a named shared pool, or attaches to an existing one when sizeInBytes is 0.
+        /// A creator that finds the object already exists re-initializes its header, so only one
+        /// process should create a given name.
+        /// </summary>
+        /// <param name="name">The shm_open name (e.g. "/frames"), or nullptr for an anonymous memfd pool.</param>
+        /// <param name="sizeInBytes">The arena size in bytes, or 0 to attach to an existing pool.</param>
+        SHARED_MEMORY_POOL(const char* name, size_t sizeInBytes)
+            : _Block(name, sizeInBytes, SHARED_POOL_HEADER::ReservedBytes)
+        {
+            Attach(sizeInBytes != 0);
+        }
+
+        /// <summary>
+        /// Attaches to an existing pool through a descriptor inherited across fork or received over a Unix socket.
+        /// </summary>
+        /// <param name="fileDescriptor">The descriptor returned by the creator's GetFileDescriptor.</param>
+        explicit SHARED_MEMORY_POOL(int fileDescriptor)
+            : _Block(fileDescriptor, SHARED_POOL_HEADER::ReservedBytes)
+        {
+            Attach(false);
+        }
+
+        ~SHARED_MEMORY_POOL() = default;
+
+        SHARED_MEMORY_POOL(const SHARED_MEMORY_POOL&) = delete;
+        SHARED_MEMORY_POOL& operator=(const SHARED_MEMORY_POOL&) = delete;
+
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Header == nullptr; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Header != nullptr; }
+        [[nodiscard]] inline int GetFileDescriptor() const noexcept { return _Block.GetFileDescriptor(); }
+        [[nodiscard]] inline void* GetBase() const noexcept { return _Block.GetHead(); }
+
+        [[nodiscard]] size_t Size() const noexcept { return _Header ? static_cast<size_t>(_Header->Capacity) : 0; }
+        [[nodiscard]] size_t BytesUsed() const noexcept { return _Header ? static_cast<size_t>(_Header->NextOffset.load(std::memory_order_relaxed)) : 0; }
+
+        /// <summary>
+        /// Returns the number of bytes producers have published. Every byte below this offset is
+        /// safe for a consumer to read. Uses acquire ordering to pair with Publish.
+        /// </summary>
+        [[nodiscard]] size_t GetPublishedBytes() const noexcept
+        {
+            return _Header ? static_cast<size_t>(_Header->PublishedOffset.load(std::memory_order_acquire)) : 0;
+        }
+
+        /// <summary>
+        /// Carves out a slice of memory of the specified size, 8-byte aligned.
+        /// Safe to call from several producer processes at once.
+        /// </summary>
+        /// <param name="sizeInBytes">The number of bytes requested.</param>
+        /// <returns>The slice if successful; otherwise a null slice if there is insufficient room remaining.</returns>
+        inline MEMORY_SLICE TakeSlice(size_t sizeInBytes) noexcept
+        {
+            return TakeAlignedSlice(sizeInBytes, 8);
+        }
+
+        /// <summary>
+        /// Carves out a slice of memory of the specified size at the specified alignment.
+        /// Alignment is relative to the arena base, which is page aligned in every process.
+        /// </summary>
+        /// <param name="sizeInBytes">The number of bytes requested.</param>
+        /// <param name="alignment">The required alignment in bytes. Must be a non-zero power of two.</param>
+        /// <returns>The slice if successful; otherwise a null slice if there is insufficient room remaining.</returns>
+        inline MEMORY_SLICE TakeAlignedSlice(size_t sizeInBytes, size_t alignment) noexcept
+        {
+            assert(sizeInBytes > 0 && "TakeAlignedSlice: cannot request 0 bytes");
+            assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "TakeAlignedSlice: alignment must be a non-zero power of two");
+
+            if (!_Header)
+                return MEMORY_SLICE(nullptr, 0);
+
+            const uint64_t capacity = _Header->Capacity;
+            uint64_t current = _Header->NextOffset.load(std::memory_order_relaxed);
+            uint64_t start, next;
+
+            do
+            {
+                start = (current + (alignment - 1)) & ~static_cast<uint64_t>(alignment - 1);
+                next = (start + sizeInBytes + 7) & ~static_cast<uint64_t>(7);
+
+                if (next > capacity)
+                    return MEMORY_SLICE(nullptr, 0);
+
+            } while (!_Header->NextOffset.compare_exchange_weak(current, next, std::memory_order_relaxed));
+
+            return MEMORY_SLICE(static_cast<unsigned char*>(_Block.GetHead()) + start, sizeInBytes);
+        }
+
+        /// <summary>
+        /// Allocates a single object of type T and constructs it in place with the provided arguments.
+        /// </summary>
+        /// <returns>A pointer to the constructed object, or nullptr if there is insufficient room remaining.</returns>
+        template<typename T, typename... Args>
+        inline T* Take(Args&&... args)
+        {
+            MEMORY_SLICE slice = TakeAlignedSlice(sizeof(T), alignof(T) > 8 ? alignof(T) : 8);
+
+            if (slice.IsNullPtr())
+                return nullptr;
+
+            T* ptr = static_cast<T*>(slice.GetHead());
+            new (ptr) T(args...);
+
+            return ptr;
+        }
+
+        /// <summary>
+        /// Allocates a contiguous array of count objects of type T and default-constructs each one.
+        /// </summary>
+        /// <returns>A pointer to the first element, or nullptr if count is zero or there is insufficient room remaining.</returns>
+        template<typename T>
+        inline T* TakeArray(size_t count)
+        {
+            if (count == 0) return nullptr;
+
+            MEMORY_SLICE slice = TakeAlignedSlice(sizeof(T) * count, alignof(T) > 8 ? alignof(T) : 8);
+
+            if (slice.IsNullPtr())
+                return nullptr;
+
+            T* ptr = static_cast<T*>(slice.GetHead());
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                new (&ptr[i]) T();
+            }
+
+            return ptr;
+        }
+
+        /// <summary>
+        /// Makes [0, endOffset) visible to consumers. Call once every byte below endOffset has been written.
+        /// Never moves the published offset backwards, so a smaller or stale offset is a no-op.
+        /// </summary>
+        /// <param name="endOffset">The arena offset just past the last byte to publish.</param>
+        inline void PublishThrough(size_t endOffset) noexcept
+        {
+            if (!_Header)
+                return;
+
+            assert(endOffset <= _Header->NextOffset.load(std::memory_order_relaxed) && "PublishThrough: offset is past the allocated region!");
+
+            uint64_t published = _Header->PublishedOffset.load(std::memory_order_relaxed);
+            while (published < endOffset &&
+                   !_Header->PublishedOffset.compare_exchange_weak(published, endOffset, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /// <summary>
+        /// Publishes through the end of a slice taken from this pool, and therefore everything below it.
+        /// </summary>
+        inline void Publish(const MEMORY_SLICE& slice) noexcept
+        {
+            if (!slice.IsNullPtr())
+                PublishThrough(OffsetOf(slice.GetHead()) + slice.GetSize());
+        }
+
+        /// <summary>
+        /// Publishes every allocation taken so far. For single-producer pools; with several producers
+        /// this would expose slices other producers have not finished writing, so use Publish(slice)
+        /// or PublishThrough under the producers' own ordering instead.
+        /// </summary>
+        inline void Publish() noexcept
+        {
+            if (_Header)
+                PublishThrough(static_cast<size_t>(_Header->NextOffset.load(std::memory_order_relaxed)));
+        }
+
+        /// <summary>
+        /// Returns the arena offset of a pointer into this pool, for handing to another process.
+        /// Asserts in debug if the pointer is outside the arena.
+        /// </summary>
+        [[nodiscard]] inline size_t OffsetOf(const void* ptr) const noexcept
+        {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(_Block.GetHead());
+            const uintptr_t p = reinterpret_cast<uintptr_t>(ptr);
+            assert(p >= base && p < base + Size() && "OffsetOf: pointer is outside the shared pool!");
+            return static_cast<size_t>(p - base);
+        }
+
+        /// <summary>
+        /// Resolves an offset received from another process into a slice in this process's mapping.
+        /// Returns a null slice if the range is not fully published.
+        /// </summary>
+        /// <param name="offset">The arena offset of the slice.</param>
+        /// <param name="sizeInBytes">The size of the slice in bytes.</param>
+        [[nodiscard]] MEMORY_SLICE SliceAt(size_t offset, size_t sizeInBytes) const noexcept
+        {
+            const size_t published = GetPublishedBytes();
+
+            if (sizeInBytes == 0 || offset > published || sizeInBytes > published - offset)
+                return MEMORY_SLICE(nullptr, 0);
+
+            return MEMORY_SLICE(static_cast<unsigned char*>(_Block.GetHead()) + offset, sizeInBytes);
+        }
+
+        /// <summary>
+        /// Resets the pool for every attached process. Does not call destructors on any allocated objects.
+        /// Only safe once no consumer is still reading the previous contents.
+        /// </summary>
+        inline void Reset() noexcept
+        {
+            if (!_Header)
+                return;
+
+            _Header->PublishedOffset.store(0, std::memory_order_relaxed);
+            _Header->NextOffset.store(0, std::memory_order_release);
+        }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,257 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        slice_list.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __SLICE_LIST_H_GUARD
+#define __SLICE_LIST_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cassert>      // assert
+#include <cstdint>      // uintptr_t, used by memory_slice.h
+#include "memory_slice.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <sys/types.h>  // ssize_t, off_t
+#include <sys/uio.h>    // iovec, readv, writev, preadv, pwritev
+#include <unistd.h>     // read, write, pread, pwrite
+#include <limits.h>     // IOV_MAX
+#include <errno.h>      // errno, EINTR
+
+
+/// <summary>
+/// A fixed-capacity list of MEMORY_SLICEs stored directly as an iovec array, so a response or record
+/// assembled from many pool slices can be handed to the kernel in one vectored call without first
+/// copying it into a contiguous buffer.
+/// Does not own the slices; the pools that produced them must outlive any I/O issued from the list.
+/// Capacity is fixed at compile time and the list lives entirely inside its own footprint.
+/// POSIX only. Not thread-safe.
+/// </summary>
+/// <typeparam name="Capacity">The maximum number of slices the list can hold.</typeparam>
+template<size_t Capacity>
+class SLICE_LIST
+{
+    static_assert(Capacity > 0, "SLICE_LIST capacity must be greater than zero!");
+
+    private:
+        iovec _Vectors[Capacity];
+        size_t _Count = 0;
+        size_t _TotalBytes = 0;
+
+#if defined(IOV_MAX)
+        static constexpr size_t MaxVectorsPerCall = IOV_MAX;
+#else
+        static constexpr size_t MaxVectorsPerCall = 1024;
+#endif
+
+        /// <summary>
+        /// Shared loop for the *All helpers. Issues vectored calls until every byte has been transferred,
+        /// resuming mid-vector after a short transfer and retrying on EINTR. The list itself is not modified.
+        /// </summary>
+        template<typename VECTORED, typename SINGLE>
+        [[nodiscard]] bool TransferAll(VECTORED vectored, SINGLE single) const noexcept
+        {
+            size_t index = 0;           // First vector not yet fully transferred
+            size_t partial = 0;         // Bytes of _Vectors[index] already transferred
+            size_t done = 0;            // Total bytes transferred, used for positional offsets
+
+            for (;;)
+            {
+                while (index < _Count && _Vectors[index].iov_len == 0)     // Empty entries would read as end of file
+                    ++index;
+
+                if (index >= _Count)
+                    return true;
+
+                ssize_t result;
+
+                if (partial != 0)       // Finish the split vector on its own so the array can be passed through untouched
+                {
+                    result = single(static_cast<char*>(_Vectors[index].iov_base) + partial, _Vectors[index].iov_len - partial, done);
+                }
+                else
+                {
+                    const size_t remaining = _Count - index;
+                    const int count = static_cast<int>(remaining < MaxVectorsPerCall ? remaining : MaxVectorsPerCall);
+                    result = vectored(_Vectors + index, count, done);
+                }
+
+                if (result < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+
+                if (result == 0)        // End of file or peer closed before the list was satisfied
+                    return false;
+
+                size_t advanced = static_cast<size_t>(result);
+                done += advanced;
+
+                while (advanced > 0)
+                {
+                    const size_t left = _Vectors[index].iov_len - partial;
+                    if (advanced < left)
+                    {
+                        partial += advanced;
+                        break;
+                    }
+                    advanced -= left;
+                    partial = 0;
+                    ++index;
+                }
+            }
+        }
+
+    public:
+
+        SLICE_LIST() = default;
+        ~SLICE_LIST() = default;
+        SLICE_LIST(const SLICE_LIST&) = default;
+        SLICE_LIST& operator=(const SLICE_LIST&) = default;
+
+        [[nodiscard]] static constexpr size_t GetCapacity() noexcept { return Capacity; }
+        [[nodiscard]] inline size_t GetCount() const noexcept { return _Count; }
+        [[nodiscard]] inline size_t GetTotalBytes() const noexcept { return _TotalBytes; }
+        [[nodiscard]] inline bool IsEmpty() const noexcept { return _Count == 0; }
+        [[nodiscard]] inline bool IsFull() const noexcept { return _Count == Capacity; }
+
+        /// <summary>
+        /// Returns the underlying iovec array, valid for GetCount() entries.
+        /// Can be passed directly to writev, readv, sendmsg or similar calls.
+        /// </summary>
+        [[nodiscard]] inline const iovec* GetVectors() const noexcept { return _Vectors; }
+
+        /// <summary>
+        /// Appends a slice to the list.
+        /// Asserts in debug if the slice is null or the list is full.
+        /// </summary>
+        /// <param name="slice">The slice to append.</param>
+        /// <returns>True if the slice was appended; false if the list is full or the slice is null.</returns>
+        [[nodiscard]] bool Add(const MEMORY_SLICE& slice) noexcept
+        {
+            return Add(slice.GetHead(), slice.GetSize());
+        }
+
+        /// <summary>
+        /// Appends a raw memory region to the list.
+        /// Asserts in debug if the pointer is null or the list is full.
+        /// </summary>
+        /// <param name="head">A pointer to the start of the region.</param>
+        /// <param name="sizeInBytes">The size of the region in bytes.</param>
+        /// <returns>True if the region was appended; false if the list is full or the pointer is null.</returns>
+        [[nodiscard]] bool Add(void* head, size_t sizeInBytes) noexcept
+        {
+            assert(head != nullptr && "SLICE_LIST::Add: cannot add a null region!");
+            assert(_Count < Capacity && "SLICE_LIST::Add: list is full!");
+
+            if (head == nullptr || _Count >= Capacity)
+                return false;
+
+            _Vectors[_Count].iov_base = head;
+            _Vectors[_Count].iov_len = sizeInBytes;
+            ++_Count;
+            _TotalBytes += sizeInBytes;
+            return true;
+        }
+
+        /// <summary>
+        /// Removes every entry from the list. Does not touch the underlying memory.
+        /// </summary>
+        inline void Clear() noexcept
+        {
+            _Count = 0;
+            _TotalBytes = 0;
+        }
+
+        /// <summary>
+        /// Copies up to maxCount entries into a caller-provided iovec array.
+        /// </summary>
+        /// <returns>The number of entries copied.</returns>
+        size_t CopyTo(iovec* out, size_t maxCount) const noexcept
+        {
+            const size_t count = _Count < maxCount ? _Count : maxCount;
+            for (size_t i = 0; i < count; ++i)
+                out[i] = _Vectors[i];
+            return count;
+        }
+
+        // ----------------------------------------------------------------
+        //  Single Call I/O
+        //  Thin wrappers that issue exactly one system call and return its result unchanged.
+        //  Lists longer than IOV_MAX must use the *All variants.
+        // ----------------------------------------------------------------
+
+        [[nodiscard]] inline ssize_t WriteV(int fd) const noexcept { return ::writev(fd, _Vectors, static_cast<int>(_Count)); }
+        [[nodiscard]] inline ssize_t ReadV(int fd) const noexcept { return ::readv(fd, _Vectors, static_cast<int>(_Count)); }
+        [[nodiscard]] inline ssize_t PWriteV(int fd, off_t offset) const noexcept { return ::pwritev(fd, _Vectors, static_cast<int>(_Count), offset); }
+        [[nodiscard]] inline ssize_t PReadV(int fd, off_t offset) const noexcept { return ::preadv(fd, _Vectors, static_cast<int>(_Count), offset); }
+
+        // ----------------------------------------------------------------
+        //  Complete Transfers
+        //  Loop until every byte in the list has been transferred, handling short
+        //  transfers, EINTR and lists longer than IOV_MAX. Failure is a runtime
+        //  condition (closed peer, full disk), so these return false rather than assert.
+        // ----------------------------------------------------------------
+
+        /// <summary>
+        /// Writes every slice to the file descriptor at its current position.
+        /// </summary>
+        /// <returns>True if all bytes were written; false on error. errno is left set by the failing call.</returns>
+        [[nodiscard]] bool WriteAll(int fd) const noexcept
+        {
+            return TransferAll(
+                [fd](const iovec* v, int n, size_t) { return ::writev(fd, v, n); },
+                [fd](const void* p, size_t n, size_t) { return ::write(fd, p, n); });
+        }
+
+        /// <summary>
+        /// Fills every slice from the file descriptor at its current position.
+        /// </summary>
+        /// <returns>True if all bytes were read; false on error or end of file. errno is left set by the failing call.</returns>
+        [[nodiscard]] bool ReadAll(int fd) const noexcept
+        {
+            return TransferAll(
+                [fd](const iovec* v, int n, size_t) { return ::readv(fd, v, n); },
+                [fd](void* p, size_t n, size_t) { return ::read(fd, p, n); });
+        }
+
+        /// <summary>
+        /// Writes every slice to the file descriptor starting at the given offset, without moving the file position.
+        /// </summary>
+        /// <returns>True if all bytes were written; false on error. errno is left set by the failing call.</returns>
+        [[nodiscard]] bool PWriteAll(int fd, off_t offset) const noexcept
+        {
+            return TransferAll(
+                [fd, offset](const iovec* v, int n, size_t done) { return ::pwritev(fd, v, n, offset + static_cast<off_t>(done)); },
+                [fd, offset](const void* p, size_t n, size_t done) { return ::pwrite(fd, p, n, offset + static_cast<off_t>(done)); });
+        }
+
+        /// <summary>
+        /// Fills every slice from the file descriptor starting at the given offset, without moving the file position.
+        /// </summary>
+        /// <returns>True if all bytes were read; false on error or end of file. errno is left set by the failing call.</returns>
+        [[nodiscard]] bool PReadAll(int fd, off_t offset) const noexcept
+        {
+            return TransferAll(
+                [fd, offset](const iovec* v, int n, size_t done) { return ::preadv(fd, v, n, offset + static_cast<off_t>(done)); },
+                [fd, offset](void* p, size_t n, size_t done) { return ::pread(fd, p, n, offset + static_cast<off_t>(done)); });
+        }
+};
+
+#endif
+
+#endif
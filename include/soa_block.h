@@ -0,0 +1,149 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        soa_block.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __SOA_BLOCK_H_GUARD
+#define __SOA_BLOCK_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include <new>          // placement new
+#include <cassert>      // assert
+#include "memory_pool.h"
+#include "typed_view.h"
+
+
+/// <summary>
+/// Resolves the type of the field at Index in a SOA_BLOCK field list.
+/// </summary>
+template<size_t Index, typename First, typename... Rest>
+struct SOA_FIELD_TYPE
+{
+    using Type = typename SOA_FIELD_TYPE<Index - 1, Rest...>::Type;
+};
+
+template<typename First, typename... Rest>
+struct SOA_FIELD_TYPE<0, First, Rest...>
+{
+    using Type = First;
+};
+
+
+/// <summary>
+/// A structure-of-arrays block: one array of count elements per field type, all carved out of a
+/// MEMORY_POOL with a single aligned take. Each field array starts on its own cache line so loops
+/// over one field never share lines with another and vector loads never split across them.
+/// Does not own its memory; lifetime is managed by the pool that produced it.
+/// Copyable since it carries no ownership semantics.
+/// </summary>
+/// <typeparam name="Fields">The element type of each field array, in order.</typeparam>
+template<typename... Fields>
+class SOA_BLOCK
+{
+    static_assert(sizeof...(Fields) > 0, "SOA_BLOCK requires at least one field!");
+
+    public:
+        static constexpr size_t CacheLineSize = 64;
+        static constexpr size_t FieldCount = sizeof...(Fields);
+
+    private:
+        void* _Arrays[FieldCount] = {};
+        size_t _Count = 0;
+
+        [[nodiscard]] static constexpr size_t AlignUp(size_t value) noexcept
+        {
+            return (value + (CacheLineSize - 1)) & ~(CacheLineSize - 1);
+        }
+
+        template<typename T>
+        static void ConstructArray(void* head, size_t count)
+        {
+            T* ptr = static_cast<T*>(head);
+            for (size_t i = 0; i < count; ++i)
+                new (&ptr[i]) T();
+        }
+
+    public:
+
+        SOA_BLOCK() = default;
+        ~SOA_BLOCK() = default;
+        SOA_BLOCK(const SOA_BLOCK&) = default;
+        SOA_BLOCK& operator=(const SOA_BLOCK&) = default;
+        SOA_BLOCK(SOA_BLOCK&&) = default;
+        SOA_BLOCK& operator=(SOA_BLOCK&&) = default;
+
+        /// <summary>
+        /// Returns the number of bytes a block of count elements takes from a pool,
+        /// excluding any leading padding needed to reach cache-line alignment.
+        /// </summary>
+        /// <param name="count">The number of elements in each field array.</param>
+        [[nodiscard]] static constexpr size_t RequiredBytes(size_t count) noexcept
+        {
+            return (AlignUp(sizeof(Fields) * count) + ... + 0);
+        }
+
+        /// <summary>
+        /// Allocates and default-constructs a structure-of-arrays block from the pool.
+        /// All field arrays come from a single cache-line aligned TakeAlignedSlice.
+        /// </summary>
+        /// <typeparam name="POOL">The pool type to allocate from.</typeparam>
+        /// <param name="pool">The pool to allocate from.</param>
+        /// <param name="count">The number of elements in each field array.</param>
+        /// <returns>
+        /// The populated block if successful;
+        /// otherwise a null block if count is zero or there is insufficient room remaining.
+        /// </returns>
+        template<typename POOL>
+        [[nodiscard]] static SOA_BLOCK Take(POOL& pool, size_t count)
+        {
+            SOA_BLOCK block;
+
+            if (count == 0)
+                return block;
+
+            MEMORY_SLICE slice = pool.TakeAlignedSlice(RequiredBytes(count), CacheLineSize);
+
+            if (slice.IsNullPtr())
+                return block;
+
+            unsigned char* cursor = static_cast<unsigned char*>(slice.GetHead());
+            size_t field = 0;
+
+            ((block._Arrays[field++] = cursor, ConstructArray<Fields>(cursor, count), cursor += AlignUp(sizeof(Fields) * count)), ...);
+
+            block._Count = count;
+            return block;
+        }
+
+        [[nodiscard]] inline size_t GetCount() const noexcept { return _Count; }
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Count == 0; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Count != 0; }
+
+        /// <summary>
+        /// Returns a typed view of the field array at the specified compile-time index.
+        /// Index is bounds-checked at compile time.
+        /// </summary>
+        /// <typeparam name="Index">The index of the field to view.</typeparam>
+        template<size_t Index>
+        [[nodiscard]] inline TYPED_VIEW<typename SOA_FIELD_TYPE<Index, Fields...>::Type> Get() const noexcept
+        {
+            static_assert(Index < FieldCount, "SOA_BLOCK field index out of bounds!");
+            using FIELD = typename SOA_FIELD_TYPE<Index, Fields...>::Type;
+
+            return TYPED_VIEW<FIELD>(static_cast<FIELD*>(_Arrays[Index]), _Count);
+        }
+};
+
+#endif
@@ -0,0 +1,195 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        static_memory_manager.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __STATIC_MEMORY_MANAGER_H_GUARD
+#define __STATIC_MEMORY_MANAGER_H_GUARD
+
+#include <cstddef>          // size_t
+#include <cassert>          // assert
+#include "memory_pool.h"
+#include "memory_block_view.h"
+
+
+namespace StaticMemoryManager
+{
+    namespace Detail
+    {
+        template<size_t... Indices>
+        struct INDICES { };
+
+        template<size_t N, size_t... Indices>
+        struct MAKE_INDICES : MAKE_INDICES<N - 1, N - 1, Indices...> { };
+
+        template<size_t... Indices>
+        struct MAKE_INDICES<0, Indices...> { using TYPE = INDICES<Indices...>; };
+    }
+}
+
+
+/// <summary>
+/// A FIXED_MEMORY_MANAGER whose pool sizes are template arguments, e.g.
+/// STATIC_MEMORY_MANAGER<64 * KB, 1 * MB, 256 * KB>. Every pool is carved from a single block taken
+/// from SOURCE at construction, each starting on a cache-line boundary, so startup costs one allocation
+/// and related pools sit next to each other. Pool offsets are compile-time constants, and
+/// GetPool<Index>() is a fixed offset from the manager. With STATIC_MEMORY_SOURCE the whole layout
+/// lives in static storage and never touches the heap.
+/// Not copyable. Not movable. Not thread-safe.
+/// </summary>
+/// <typeparam name="SOURCE">The memory source for the shared block (see memory_source.h).</typeparam>
+/// <typeparam name="Sizes">The size in bytes of each pool, in order.</typeparam>
+template<typename SOURCE, size_t... Sizes>
+class BASIC_STATIC_MEMORY_MANAGER
+{
+    static_assert(sizeof...(Sizes) > 0, "BASIC_STATIC_MEMORY_MANAGER: at least one pool size is required!");
+
+    public:
+        using POOL = BASIC_MEMORY_POOL<MEMORY_BLOCK_VIEW>;
+
+        static constexpr size_t Count = sizeof...(Sizes);
+
+    private:
+        static constexpr size_t SizeList[Count] = { Sizes... };
+
+        [[nodiscard]] static constexpr size_t RoundToCacheLine(size_t sizeInBytes) noexcept
+        {
+            return (sizeInBytes + MemoryAlign::CacheLine - 1) & ~(MemoryAlign::CacheLine - 1);
+        }
+
+    public:
+
+        /// <summary>
+        /// Returns the offset of a pool from the start of the shared block. A compile-time constant.
+        /// </summary>
+        [[nodiscard]] static constexpr size_t PoolOffset(size_t index) noexcept
+        {
+            size_t offset = 0;
+            for (size_t i = 0; i < index; ++i)
+                offset += RoundToCacheLine(SizeList[i]);
+            return offset;
+        }
+
+        /// <summary>
+        /// The size of the shared block: every pool, each rounded up to a cache line.
+        /// </summary>
+        static constexpr size_t TotalBytes = PoolOffset(Count);
+
+    private:
+        BASIC_MEMORY_BLOCK<SOURCE> _Block;      // The one allocation every pool is carved from
+        POOL _Pools[Count];
+
+        /// <summary>
+        /// The head of pool index within the block, or nullptr if the block failed to allocate so
+        /// that every pool is a null pool rather than a view at a small bogus address.
+        /// </summary>
+        [[nodiscard]] inline void* PoolHead(size_t index) const noexcept
+        {
+            return _Block.IsNullPtr() ? nullptr : static_cast<char*>(_Block.GetHead()) + PoolOffset(index);
+        }
+
+        template<size_t... Indices>
+        BASIC_STATIC_MEMORY_MANAGER(StaticMemoryManager::Detail::INDICES<Indices...>, bool prefault)
+            : _Block(TotalBytes, prefault, MemoryAlign::CacheLine),
+              _Pools{ POOL(PoolHead(Indices), SizeList[Indices])... }
+        {
+        }
+
+    public:
+
+        /// <summary>
+        /// Allocates the shared block and lays the pools out across it.
+        /// </summary>
+        /// <param name="prefault">True to fault in every page of the block now. Defaults to false.</param>
+        explicit BASIC_STATIC_MEMORY_MANAGER(bool prefault = false)
+            : BASIC_STATIC_MEMORY_MANAGER(typename StaticMemoryManager::Detail::MAKE_INDICES<Count>::TYPE(), prefault)
+        {
+        }
+
+        ~BASIC_STATIC_MEMORY_MANAGER() = default;
+        BASIC_STATIC_MEMORY_MANAGER(const BASIC_STATIC_MEMORY_MANAGER&) = delete;
+        BASIC_STATIC_MEMORY_MANAGER& operator=(const BASIC_STATIC_MEMORY_MANAGER&) = delete;
+        BASIC_STATIC_MEMORY_MANAGER(BASIC_STATIC_MEMORY_MANAGER&&) = delete;
+        BASIC_STATIC_MEMORY_MANAGER& operator=(BASIC_STATIC_MEMORY_MANAGER&&) = delete;
+
+        [[nodiscard]] static constexpr size_t MaxPoolCount() noexcept { return Count; }
+        [[nodiscard]] static constexpr size_t ActivePoolCount() noexcept { return Count; }
+
+        /// <summary>
+        /// Returns the start of the shared block.
+        /// </summary>
+        [[nodiscard]] inline void* GetHead() const noexcept { return _Block.GetHead(); }
+
+        /// <summary>
+        /// Returns a reference to the pool at the specified compile-time index.
+        /// Index is bounds-checked at compile time.
+        /// </summary>
+        template<size_t Index>
+        [[nodiscard]] inline POOL& GetPool() noexcept
+        {
+            static_assert(Index < Count, "Pool index out of bounds!");
+            return _Pools[Index];
+        }
+
+        /// <summary>
+        /// Returns a reference to the pool at the specified runtime index.
+        /// Asserts in debug if the index is out of bounds.
+        /// </summary>
+        [[nodiscard]] inline POOL& GetPool(size_t index) noexcept
+        {
+            assert(index < Count && "Pool index out of bounds!");
+            return _Pools[index];
+        }
+
+        /// <summary>
+        /// Resets the pool at the specified compile-time index.
+        /// Does not call destructors on any allocated objects.
+        /// </summary>
+        template<size_t Index>
+        void ResetPool() noexcept
+        {
+            static_assert(Index < Count, "Pool index out of bounds!");
+            _Pools[Index].Reset();
+        }
+
+        /// <summary>
+        /// Resets the pool at the specified runtime index.
+        /// Does not call destructors on any allocated objects.
+        /// </summary>
+        void ResetPool(size_t index) noexcept
+        {
+            assert(index < Count && "Pool index out of bounds!");
+            _Pools[index].Reset();
+        }
+
+        /// <summary>
+        /// Resets all pools, making their memory available for reuse.
+        /// Does not call destructors on any allocated objects.
+        /// </summary>
+        void ResetAll() noexcept
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                _Pools[i].Reset();
+            }
+        }
+};
+
+/// <summary>
+/// A BASIC_STATIC_MEMORY_MANAGER over one heap allocation.
+/// </summary>
+template<size_t... Sizes>
+using STATIC_MEMORY_MANAGER = BASIC_STATIC_MEMORY_MANAGER<HEAP_MEMORY_SOURCE, Sizes...>;
+
+#endif
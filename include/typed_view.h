@@ -0,0 +1,232 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        typed_view.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __TYPED_VIEW_H_GUARD
+#define __TYPED_VIEW_H_GUARD
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include <cassert>      // assert
+#include "memory_slice.h"
+
+
+/// <summary>
+/// A non-owning, element-indexed view of a contiguous array of T.
+/// Wraps a MEMORY_SLICE so callers index by element rather than computing byte offsets, and
+/// exposes raw begin/end pointers so range-for loops over it compile to plain pointer loops
+/// the optimizer can vectorize.
+/// Copyable since it carries no ownership semantics.
+/// </summary>
+/// <typeparam name="T">The element type.</typeparam>
+template<typename T>
+class TYPED_VIEW
+{
+    private:
+        T* _Head = nullptr;
+        size_t _Count = 0;
+
+    public:
+
+        TYPED_VIEW() = default;
+
+        /// <summary>
+        /// Constructs a view over an existing array.
+        /// </summary>
+        /// <param name="head">A pointer to the first element.</param>
+        /// <param name="count">The number of elements.</param>
+        TYPED_VIEW(T* head, size_t count) noexcept : _Head(head), _Count(head ? count : 0) { }
+
+        /// <summary>
+        /// Constructs a view covering every whole T that fits in the slice.
+        /// Asserts in debug if the slice head is not aligned for T.
+        /// A null slice produces an empty view.
+        /// </summary>
+        /// <param name="slice">The memory to view.</param>
+        explicit TYPED_VIEW(const MEMORY_SLICE& slice) noexcept
+            : _Head(static_cast<T*>(slice.GetHead())), _Count(slice.GetHead() ? slice.GetSize() / sizeof(T) : 0)
+        {
+            assert(slice.IsAligned(alignof(T)) && "TYPED_VIEW: slice is not aligned for T!");
+        }
+
+        ~TYPED_VIEW() = default;
+        TYPED_VIEW(const TYPED_VIEW&) = default;
+        TYPED_VIEW& operator=(const TYPED_VIEW&) = default;
+        TYPED_VIEW(TYPED_VIEW&&) = default;
+        TYPED_VIEW& operator=(TYPED_VIEW&&) = default;
+
+        [[nodiscard]] inline T* GetData() const noexcept { return _Head; }
+        [[nodiscard]] inline size_t GetCount() const noexcept { return _Count; }
+        [[nodiscard]] inline size_t GetSizeInBytes() const noexcept { return _Count * sizeof(T); }
+        [[nodiscard]] inline bool IsEmpty() const noexcept { return _Count == 0; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+
+        [[nodiscard]] inline T* begin() const noexcept { return _Head; }
+        [[nodiscard]] inline T* end() const noexcept { return _Head + _Count; }
+
+        /// <summary>
+        /// Returns a reference to the element at the specified index.
+        /// Asserts in debug if the index is out of range.
+        /// </summary>
+        [[nodiscard]] inline T& operator[](size_t index) const noexcept
+        {
+            assert(index < _Count && "TYPED_VIEW: index out of range!");
+            return _Head[index];
+        }
+
+        /// <summary>
+        /// Returns a view of count elements starting at the specified element.
+        /// Returns an empty view if the range would exceed this view.
+        /// </summary>
+        /// <param name="first">The index of the first element in the subview.</param>
+        /// <param name="count">The number of elements in the subview.</param>
+        [[nodiscard]] TYPED_VIEW Subview(size_t first, size_t count) const noexcept
+        {
+            if (first > _Count || count > _Count - first)
+                return TYPED_VIEW();
+
+            return TYPED_VIEW(_Head + first, count);
+        }
+
+        /// <summary>
+        /// Assigns value to every element in the view.
+        /// </summary>
+        void Fill(const T& value) noexcept
+        {
+            for (size_t i = 0; i < _Count; ++i)
+                _Head[i] = value;
+        }
+};
+
+
+/// <summary>
+/// A non-owning view of count elements of T spaced a fixed number of bytes apart.
+/// Typical use is viewing a single field across an array of structs, e.g.
+/// STRIDED_VIEW&lt;float&gt;(slice, sizeof(PARTICLE), offsetof(PARTICLE, X)).
+/// Copyable since it carries no ownership semantics.
+/// </summary>
+/// <typeparam name="T">The element type.</typeparam>
+template<typename T>
+class STRIDED_VIEW
+{
+    private:
+        unsigned char* _Head = nullptr;
+        size_t _Count = 0;
+        size_t _Stride = sizeof(T);         // Distance between consecutive elements in bytes
+
+    public:
+
+        /// <summary>
+        /// Forward iterator that steps by the view's stride.
+        /// </summary>
+        class ITERATOR
+        {
+            private:
+                unsigned char* _Ptr;
+                size_t _Stride;
+
+            public:
+                ITERATOR(unsigned char* ptr, size_t stride) noexcept : _Ptr(ptr), _Stride(stride) { }
+
+                [[nodiscard]] inline T& operator*() const noexcept { return *reinterpret_cast<T*>(_Ptr); }
+                [[nodiscard]] inline T* operator->() const noexcept { return reinterpret_cast<T*>(_Ptr); }
+                inline ITERATOR& operator++() noexcept { _Ptr += _Stride; return *this; }
+                [[nodiscard]] inline bool operator==(const ITERATOR& other) const noexcept { return _Ptr == other._Ptr; }
+                [[nodiscard]] inline bool operator!=(const ITERATOR& other) const noexcept { return _Ptr != other._Ptr; }
+        };
+
+        STRIDED_VIEW() = default;
+
+        /// <summary>
+        /// Constructs a view over count elements starting at head, strideInBytes apart.
+        /// Asserts in debug if the stride is smaller than T.
+        /// </summary>
+        STRIDED_VIEW(void* head, size_t count, size_t strideInBytes) noexcept
+            : _Head(static_cast<unsigned char*>(head)), _Count(head ? count : 0), _Stride(strideInBytes)
+        {
+            assert(strideInBytes >= sizeof(T) && "STRIDED_VIEW: stride is smaller than the element type!");
+        }
+
+        /// <summary>
+        /// Constructs a view over every element that fits in the slice, starting byteOffset bytes in
+        /// and advancing strideInBytes per element.
+        /// Asserts in debug if the stride is smaller than T or the first element is misaligned.
+        /// A null slice or an offset that leaves no room for one element produces an empty view.
+        /// </summary>
+        /// <param name="slice">The memory to view.</param>
+        /// <param name="strideInBytes">The distance between consecutive elements in bytes.</param>
+        /// <param name="byteOffset">The byte offset of the first element. Defaults to 0.</param>
+        STRIDED_VIEW(const MEMORY_SLICE& slice, size_t strideInBytes, size_t byteOffset = 0) noexcept : _Stride(strideInBytes)
+        {
+            assert(strideInBytes >= sizeof(T) && "STRIDED_VIEW: stride is smaller than the element type!");
+
+            if (slice.IsNullPtr() || byteOffset >= slice.GetSize() || slice.GetSize() - byteOffset < sizeof(T))
+                return;
+
+            _Head = static_cast<unsigned char*>(slice.GetHead()) + byteOffset;
+            _Count = (slice.GetSize() - byteOffset - sizeof(T)) / strideInBytes + 1;
+
+            assert((reinterpret_cast<uintptr_t>(_Head) & (alignof(T) - 1)) == 0 && "STRIDED_VIEW: first element is not aligned for T!");
+        }
+
+        ~STRIDED_VIEW() = default;
+        STRIDED_VIEW(const STRIDED_VIEW&) = default;
+        STRIDED_VIEW& operator=(const STRIDED_VIEW&) = default;
+        STRIDED_VIEW(STRIDED_VIEW&&) = default;
+        STRIDED_VIEW& operator=(STRIDED_VIEW&&) = default;
+
+        [[nodiscard]] inline size_t GetCount() const noexcept { return _Count; }
+        [[nodiscard]] inline size_t GetStride() const noexcept { return _Stride; }
+        [[nodiscard]] inline bool IsEmpty() const noexcept { return _Count == 0; }
+        [[nodiscard]] inline bool IsContiguous() const noexcept { return _Stride == sizeof(T); }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+
+        [[nodiscard]] inline ITERATOR begin() const noexcept { return ITERATOR(_Head, _Stride); }
+        [[nodiscard]] inline ITERATOR end() const noexcept { return ITERATOR(_Head + _Count * _Stride, _Stride); }
+
+        /// <summary>
+        /// Returns a reference to the element at the specified index.
+        /// Asserts in debug if the index is out of range.
+        /// </summary>
+        [[nodiscard]] inline T& operator[](size_t index) const noexcept
+        {
+            assert(index < _Count && "STRIDED_VIEW: index out of range!");
+            return *reinterpret_cast<T*>(_Head + index * _Stride);
+        }
+
+        /// <summary>
+        /// Returns a view of count elements starting at the specified element, keeping the same stride.
+        /// Returns an empty view if the range would exceed this view.
+        /// </summary>
+        [[nodiscard]] STRIDED_VIEW Subview(size_t first, size_t count) const noexcept
+        {
+            if (first > _Count || count > _Count - first)
+                return STRIDED_VIEW();
+
+            return STRIDED_VIEW(_Head + first * _Stride, count, _Stride);
+        }
+
+        /// <summary>
+        /// Returns a contiguous TYPED_VIEW over the same elements.
+        /// Asserts in debug if the stride does not equal sizeof(T).
+        /// </summary>
+        [[nodiscard]] TYPED_VIEW<T> AsContiguous() const noexcept
+        {
+            assert(IsContiguous() && "AsContiguous: view is not contiguous!");
+            return TYPED_VIEW<T>(reinterpret_cast<T*>(_Head), _Count);
+        }
+};
+
+#endif
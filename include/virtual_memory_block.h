@@ -0,0 +1,153 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        virtual_memory_block.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __VIRTUAL_MEMORY_BLOCK_H_GUARD
+#define __VIRTUAL_MEMORY_BLOCK_H_GUARD
+
+#include <cstddef>      // size_t
+#include "memory_budget.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <sys/mman.h>   // mmap, munmap, mprotect, madvise
+#include <unistd.h>     // sysconf
+
+
+/// <summary>
+/// A block that reserves a large range of address space up front but only commits memory as it is used.
+/// The whole range is mapped PROT_NONE at construction, which costs no memory; EnsureCommitted makes
+/// pages readable and writable in granule-sized steps as a pool's bump offset advances. The block
+/// never moves, so pointers stay valid however far the pool grows, and allocation only fails once
+/// the reservation itself is exhausted or the system refuses to commit more.
+/// GetSize reports the reservation; GetCommittedSize reports how much is currently usable.
+/// Given a MEMORY_BUDGET, every commit is charged to it first and every decommit released, so the
+/// pool stops growing (and TakeSlice returns a null slice) once the budget refuses.
+/// Failing to reserve is a runtime condition; check IsNullPtr or the bool conversion.
+/// Not copyable or movable; ownership is strict and non-transferable. POSIX only.
+/// </summary>
+class VIRTUAL_MEMORY_BLOCK
+{
+    private:
+        void* _Head = nullptr;
+        size_t _SizeInBytes = 0;            // Reserved address space
+        size_t _CommittedBytes = 0;         // Leading bytes currently readable and writable
+        size_t _Granule = 0;                // Commit step, a whole number of pages
+        MEMORY_BUDGET* _Budget = nullptr;   // Charged for committed bytes; not owned
+
+        /// <summary>
+        /// Commits enough granules to cover endOffset. Kept out of line from EnsureCommitted's fast check.
+        /// </summary>
+        bool Grow(size_t endOffset) noexcept
+        {
+            if (_Head == nullptr || endOffset > _SizeInBytes)
+                return false;
+
+            size_t target = (endOffset + _Granule - 1) / _Granule * _Granule;
+            if (target > _SizeInBytes)
+                target = _SizeInBytes;
+
+            if (_Budget != nullptr && !_Budget->TryCharge(target - _CommittedBytes))
+                return false;
+
+            if (::mprotect(static_cast<char*>(_Head) + _CommittedBytes, target - _CommittedBytes, PROT_READ | PROT_WRITE) != 0)
+            {
+                if (_Budget != nullptr)
+                    _Budget->Release(target - _CommittedBytes);
+                return false;
+            }
+
+            _CommittedBytes = target;
+            return true;
+        }
+
+    public:
+
+        /// <summary>
+        /// Reserves sizeInBytes of address space without committing any of it.
+        /// </summary>
+        /// <param name="sizeInBytes">The size of the reservation in bytes, e.g. 64 GB.</param>
+        /// <param name="commitGranule">The number of bytes committed at a time, rounded up to whole pages. Defaults to 2 MB.</param>
+        /// <param name="budget">An optional budget to charge commits against, e.g. &manager.GetBudget(). Must outlive the block.</param>
+        explicit VIRTUAL_MEMORY_BLOCK(size_t sizeInBytes, size_t commitGranule = size_t(2) << 20, MEMORY_BUDGET* budget = nullptr)
+            : _Budget(budget)
+        {
+            const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            _Granule = commitGranule < pageSize ? pageSize : (commitGranule + pageSize - 1) / pageSize * pageSize;
+
+            void* mapping = ::mmap(nullptr, sizeInBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (mapping == MAP_FAILED)
+                return;
+
+            _Head = mapping;
+            _SizeInBytes = sizeInBytes;
+        }
+
+        ~VIRTUAL_MEMORY_BLOCK()
+        {
+            if (_Head)
+                ::munmap(_Head, _SizeInBytes);
+            if (_Budget != nullptr)
+                _Budget->Release(_CommittedBytes);
+        }
+
+        VIRTUAL_MEMORY_BLOCK(const VIRTUAL_MEMORY_BLOCK&) = delete;
+        VIRTUAL_MEMORY_BLOCK& operator=(const VIRTUAL_MEMORY_BLOCK&) = delete;
+        VIRTUAL_MEMORY_BLOCK(VIRTUAL_MEMORY_BLOCK&&) = delete;
+        VIRTUAL_MEMORY_BLOCK& operator=(VIRTUAL_MEMORY_BLOCK&&) = delete;
+
+        [[nodiscard]] inline void* GetHead() const noexcept { return _Head; }
+        [[nodiscard]] inline size_t GetSize() const noexcept { return _SizeInBytes; }
+        [[nodiscard]] inline size_t GetCommittedSize() const noexcept { return _CommittedBytes; }
+        [[nodiscard]] inline bool IsNullPtr() const noexcept { return _Head == nullptr; }
+        [[nodiscard]] explicit operator bool() const noexcept { return _Head != nullptr; }
+
+        /// <summary>
+        /// Makes [0, endOffset) usable, committing whole granules as needed.
+        /// Called by BASIC_MEMORY_POOL before handing out memory; costs one compare when already committed.
+        /// </summary>
+        /// <param name="endOffset">The end of the range that must be usable.</param>
+        /// <returns>True if the range is committed; false if it exceeds the reservation or the commit failed.</returns>
+        inline bool EnsureCommitted(size_t endOffset) noexcept
+        {
+            return endOffset <= _CommittedBytes || Grow(endOffset);
+        }
+
+        /// <summary>
+        /// Returns committed memory beyond keepBytes (rounded up to a granule) to the system and makes
+        /// it inaccessible again. The address range stays reserved and is recommitted on demand.
+        /// </summary>
+        /// <param name="keepBytes">The number of leading bytes that must stay committed.</param>
+        void Decommit(size_t keepBytes) noexcept
+        {
+            size_t keep = (keepBytes + _Granule - 1) / _Granule * _Granule;
+            if (keep >= _CommittedBytes)
+                return;
+
+            char* start = static_cast<char*>(_Head) + keep;
+            const size_t length = _CommittedBytes - keep;
+
+            ::madvise(start, length, MADV_DONTNEED);
+            ::mprotect(start, length, PROT_NONE);
+            _CommittedBytes = keep;
+
+            if (_Budget != nullptr)
+                _Budget->Release(length);
+        }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+// ============================================================================
+// MemoryCPP - High Performance Arena Allocator & Memory Utility Library
+// ----------------------------------------------------------------------------
+// File:        virtual_memory_pool.h
+// Author:      Jason Penick
+// Website:     630Studios.com
+// Created:     2026
+//
+// Copyright (c) 2026 Jason Penick. All rights reserved.
+//
+// This software is provided under the terms outlined in LICENSE.txt
+// See README.md for full documentation and usage examples
+// ============================================================================
+
+#pragma once
+
+#ifndef __VIRTUAL_MEMORY_POOL_H_GUARD
+#define __VIRTUAL_MEMORY_POOL_H_GUARD
+
+#include "memory_pool.h"
+#include "virtual_memory_block.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+
+/// <summary>
+/// A growable pool with stable addresses. Constructed with a reservation size (and optionally a
+/// commit granule), e.g. VIRTUAL_MEMORY_POOL pool(64ull << 30); memory is committed granule by granule
+/// as the bump offset advances, so TakeSlice only fails once the reservation is exhausted.
+/// Call ReleaseUnused after Reset to hand committed memory above the offset back to the system.
+/// Pass a MEMORY_BUDGET as the third argument to cap how much the pool may commit.
+/// Not copyable. Not thread-safe. POSIX only.
+/// </summary>
+using VIRTUAL_MEMORY_POOL = BASIC_MEMORY_POOL<VIRTUAL_MEMORY_BLOCK>;
+
+#endif
+
+#endif